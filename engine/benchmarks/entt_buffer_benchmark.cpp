@@ -0,0 +1,480 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "entt_buffer_benchmark.hpp"
+#include "entt_buffer.hpp"
+#include "entt_reflection_wrapper.hpp"
+#include "frame_time_statistics.hpp"
+#include "life_object_component.hpp"
+#include "log.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+
+using namespace MeowEngine::entity;
+
+namespace {
+    /**
+     * Physics stages without a scene, bodies stay unbound so staging syncs only move components
+     */
+    struct BenchmarkPhysics : MeowEngine::simulator::Physics {
+        void Create() override {}
+        void Update(float inFixedDeltaTime) override {}
+
+        void AddRigidbody(entt::entity inEntity, Transform3DComponent& transform, ColliderComponent& collider, RigidbodyComponent& rigidbody) override {}
+        void AddRigidbodies(const std::vector<MeowEngine::simulator::RigidbodyBinding>& inBindings) override {}
+        void RemoveRigidbodies(const std::vector<RigidbodyComponent*>& inRigidbodies) override {}
+
+        const std::vector<entt::entity>& GetActiveEntities() const override {
+            return ActiveEntities;
+        }
+
+        void ClearActiveEntities() override {}
+
+        std::vector<entt::entity> ActiveEntities;
+    };
+
+    enum class Stage {
+        AddRemoveOnMain,
+        SyncWithStaging,
+        ApplyAddRemoveOnStaging,
+        ApplyDeltasOnStaging,
+        ApplyPropertyChangeOnStaging,
+        PublishToCurrent,
+        SyncWithFinal,
+        ApplyPropertyChange,
+        ApplyRemovals,
+        Swap,
+        Frame,
+        Count
+    };
+
+    constexpr std::array<const char*, static_cast<std::size_t>(Stage::Count)> StageNames = {
+        "AddRemoveOnMain",
+        "SyncWithStaging",
+        "ApplyAddRemoveOnStaging",
+        "ApplyDeltasOnStaging",
+        "ApplyPropertyChangeOnStaging",
+        "PublishToCurrent",
+        "SyncWithFinal",
+        "ApplyPropertyChange",
+        "ApplyRemovals",
+        "Swap",
+        "Frame"
+    };
+
+    /**
+     * Entities of one component mix, a cursor walks them so every frame touches a different window
+     */
+    struct EntityGroup {
+        std::vector<entt::entity> Entities;
+        std::size_t ChangeCursor = 0;
+        std::size_t ChurnCursor = 0;
+
+        template<typename Callback>
+        void ForEachInWindow(std::size_t& inOutCursor, std::size_t inCount, Callback&& inCallback) {
+            if(Entities.empty()) {
+                return;
+            }
+
+            inCount = std::min(inCount, Entities.size());
+            for(std::size_t i = 0; i < inCount; i++) {
+                inCallback(Entities[inOutCursor], inOutCursor);
+                inOutCursor = (inOutCursor + 1) % Entities.size();
+            }
+        }
+    };
+
+    Stage GetStage(MeowEngine::EnttSyncStage inStage) {
+        switch(inStage) {
+            case MeowEngine::EnttSyncStage::SyncWithStaging: return Stage::SyncWithStaging;
+            case MeowEngine::EnttSyncStage::ApplyDeltasOnStaging: return Stage::ApplyDeltasOnStaging;
+            case MeowEngine::EnttSyncStage::ApplyPropertyChangeOnStaging: return Stage::ApplyPropertyChangeOnStaging;
+            case MeowEngine::EnttSyncStage::PublishToCurrent: return Stage::PublishToCurrent;
+            case MeowEngine::EnttSyncStage::SyncWithFinal: return Stage::SyncWithFinal;
+            case MeowEngine::EnttSyncStage::ApplyPropertyChange: return Stage::ApplyPropertyChange;
+            case MeowEngine::EnttSyncStage::ApplyRemovals: return Stage::ApplyRemovals;
+        }
+
+        return Stage::Frame;
+    }
+
+    std::size_t GetShare(std::size_t inCount, float inRatio) {
+        return static_cast<std::size_t>(static_cast<double>(inCount) * inRatio);
+    }
+
+    float ParseRatio(const char* inValue, float inFallback) {
+        const float ratio = static_cast<float>(std::atof(inValue));
+        return ratio >= 0.0f && ratio <= 1.0f ? ratio : inFallback;
+    }
+
+    class BenchmarkRun {
+    public:
+        BenchmarkRun(const MeowEngine::EnttBufferBenchmarkSettings& inSettings, std::size_t inEntityCount)
+        : Settings(inSettings)
+        , EntityCount(inEntityCount)
+        , Buffer(std::make_unique<MeowEngine::EnttBuffer>())
+        , SpawnTime(0.0)
+        , FrameIndex(0) {
+            for(const char* name : StageNames) {
+                Statistics.emplace_back(name, static_cast<std::size_t>(inSettings.FrameCount));
+            }
+
+            Buffer->TrackChanges<Transform3DComponent>();
+        }
+
+        void Run() {
+            const auto spawnStartTime = std::chrono::steady_clock::now();
+
+            const std::size_t physicsCount = GetShare(EntityCount, Settings.PhysicsRatio);
+            PhysicsEntities.Entities = SpawnPhysicsEntities(physicsCount);
+            PlainEntities.Entities = SpawnPlainEntities(EntityCount - physicsCount);
+
+            // spawn reaches staging & final with the first sync, counted as part of spawning
+            Buffer->SyncPhysicsOnMain<Transform3DComponent>();
+            Buffer->ApplyAddRemoveOnStaging(&Physics);
+            Buffer->SyncRenderOnMain<Transform3DComponent>();
+            Buffer->Swap();
+
+            const std::chrono::duration<double> spawnTime = std::chrono::steady_clock::now() - spawnStartTime;
+            SpawnTime = spawnTime.count();
+
+            for(int i = 0; i < Settings.WarmupFrameCount; i++) {
+                RunFrame(false);
+            }
+
+            for(int i = 0; i < Settings.FrameCount; i++) {
+                RunFrame(true);
+            }
+        }
+
+        void WriteJson(std::ostream& outStream) const {
+            outStream << "    {\n"
+                      << "      \"entities\": " << EntityCount << ",\n"
+                      << "      \"physics_entities\": " << PhysicsEntities.Entities.size() << ",\n"
+                      << "      \"spawn_ms\": " << SpawnTime * 1000.0 << ",\n"
+                      << "      \"stages\": {\n";
+
+            for(std::size_t i = 0; i < Statistics.size(); i++) {
+                const MeowEngine::FrameTimeStatistics& statistics = Statistics[i];
+
+                outStream << "        \"" << StageNames[i] << "\": {"
+                          << "\"mean_ms\": " << statistics.GetMean() * 1000.0
+                          << ", \"p50_ms\": " << statistics.GetPercentile(50.0) * 1000.0
+                          << ", \"p99_ms\": " << statistics.GetPercentile(99.0) * 1000.0
+                          << ", \"max_ms\": " << statistics.GetPercentile(100.0) * 1000.0
+                          << "}" << (i + 1 < Statistics.size() ? "," : "") << "\n";
+            }
+
+            outStream << "      }\n"
+                      << "    }";
+        }
+
+        void Print() const {
+            std::printf("EnttBuffer sync, %zu entities (%zu physics), spawn %.3fms\n",
+                        EntityCount, PhysicsEntities.Entities.size(), SpawnTime * 1000.0);
+
+            for(const MeowEngine::FrameTimeStatistics& statistics : Statistics) {
+                statistics.Print();
+            }
+        }
+
+    private:
+        /**
+         * Same order as a main frame with SyncBuffers job, physics job chain in between runs fully each frame.
+         * Syncs go through the EnttBuffer functions MainScene calls, only PhysX & render extraction are left out.
+         */
+        void RunFrame(bool inIsMeasured) {
+            const auto frameStartTime = std::chrono::steady_clock::now();
+
+            // main update ---------------
+            Measure(Stage::AddRemoveOnMain, inIsMeasured, [this] {
+                Churn(PhysicsEntities, true);
+                Churn(PlainEntities, false);
+            });
+
+            MoveOnMain(PhysicsEntities);
+            MoveOnMain(PlainEntities);
+
+            // ui edits of last render frame
+            PushPropertyEdits();
+
+            auto measureStage = [this, inIsMeasured](MeowEngine::EnttSyncStage inStage, auto&& inStep) {
+                Measure(::GetStage(inStage), inIsMeasured, inStep);
+            };
+
+            // main sync with physics -----
+            Buffer->SyncPhysicsOnMain<Transform3DComponent>(measureStage);
+
+            // physics frame -------------
+            Measure(Stage::ApplyAddRemoveOnStaging, inIsMeasured, [this] {
+                Buffer->ApplyAddRemoveOnStaging(&Physics);
+            });
+
+            Buffer->SyncPhysicsOnStaging<Transform3DComponent>([this] {
+                MoveOnStaging();
+            }, measureStage);
+
+            // main sync with render -----
+            Buffer->SyncRenderOnMain<Transform3DComponent>(measureStage);
+
+            Measure(Stage::Swap, inIsMeasured, [this] {
+                Buffer->Swap();
+            });
+
+            if(inIsMeasured) {
+                const std::chrono::duration<double> frameTime = std::chrono::steady_clock::now() - frameStartTime;
+                Statistics[static_cast<std::size_t>(Stage::Frame)].AddSample(frameTime.count());
+            }
+
+            FrameIndex++;
+        }
+
+        template<typename Callback>
+        void Measure(Stage inStage, bool inIsMeasured, Callback&& inCallback) {
+            const auto startTime = std::chrono::steady_clock::now();
+            inCallback();
+
+            if(inIsMeasured) {
+                const std::chrono::duration<double> stageTime = std::chrono::steady_clock::now() - startTime;
+                Statistics[static_cast<std::size_t>(inStage)].AddSample(stageTime.count());
+            }
+        }
+
+        std::vector<entt::entity> SpawnPhysicsEntities(std::size_t inCount) {
+            if(inCount == 0) {
+                return {};
+            }
+
+            return Buffer->AddEntities(
+                    inCount,
+                    LifeObjectComponent("physics"),
+                    CreateTransform(),
+                    ColliderComponent(ColliderType::BOX, &ColliderData),
+                    RigidbodyComponent()
+            );
+        }
+
+        std::vector<entt::entity> SpawnPlainEntities(std::size_t inCount) {
+            if(inCount == 0) {
+                return {};
+            }
+
+            return Buffer->AddEntities(
+                    inCount,
+                    LifeObjectComponent("plain"),
+                    CreateTransform()
+            );
+        }
+
+        static Transform3DComponent CreateTransform() {
+            return Transform3DComponent(glm::mat4(1.0f), glm::vec3{0.0f, 20.0f, 0.0f}, glm::vec3{0.5f, 0.5f, 0.5f}, glm::vec3{0.0f, 1.0f, 0.0f}, 0);
+        }
+
+        /**
+         * Removes a window of the group & spawns as many again, new ids take the removed slots
+         */
+        void Churn(EntityGroup& inGroup, bool inIsPhysics) {
+            const std::size_t churnCount = GetShare(inGroup.Entities.size(), Settings.ChurnRatio);
+            if(churnCount == 0) {
+                return;
+            }
+
+            const std::size_t firstSlot = inGroup.ChurnCursor;
+            std::vector<entt::entity> removed;
+            removed.reserve(churnCount);
+            inGroup.ForEachInWindow(inGroup.ChurnCursor, churnCount, [&removed](entt::entity inEntity, std::size_t inSlot) {
+                removed.push_back(inEntity);
+            });
+            Buffer->RemoveEntities(removed);
+
+            const std::vector<entt::entity> spawned = inIsPhysics ? SpawnPhysicsEntities(removed.size()) : SpawnPlainEntities(removed.size());
+            for(std::size_t i = 0; i < spawned.size(); i++) {
+                inGroup.Entities[(firstSlot + i) % inGroup.Entities.size()] = spawned[i];
+            }
+        }
+
+        void MoveOnMain(EntityGroup& inGroup) {
+            auto& transforms = Buffer->GetCurrent().storage<Transform3DComponent>();
+            MeowEngine::DirtyBitset& changes = Buffer->GetCurrentChanges<Transform3DComponent>();
+
+            inGroup.ForEachInWindow(inGroup.ChangeCursor, GetShare(inGroup.Entities.size(), Settings.MainChangeRatio), [&](entt::entity inEntity, std::size_t inSlot) {
+                if(transforms.contains(inEntity)) {
+                    transforms.get(inEntity).Position.X += 0.01f;
+                    changes.Mark(entt::to_entity(inEntity));
+                }
+            });
+        }
+
+        /**
+         * Stands in for rigidbody UpdateTransform of bodies physics reported active
+         */
+        void MoveOnStaging() {
+            auto view = Buffer->GetStaging().view<Transform3DComponent, RigidbodyComponent>();
+            MeowEngine::DirtyBitset& changes = Buffer->GetStagingChanges<Transform3DComponent>();
+
+            PhysicsEntities.ForEachInWindow(PhysicsMoveCursor, GetShare(PhysicsEntities.Entities.size(), Settings.PhysicsChangeRatio), [&](entt::entity inEntity, std::size_t inSlot) {
+                if(!view.contains(inEntity)) {
+                    return;
+                }
+
+                Transform3DComponent& transform = view.get<Transform3DComponent>(inEntity);
+                transform.PreviousPhysicsPosition = transform.PhysicsPosition;
+                transform.Position.Y -= 0.01f;
+                transform.PhysicsPosition = transform.Position;
+                changes.Mark(entt::to_entity(inEntity));
+            });
+        }
+
+        void PushPropertyEdits() {
+            const entt::id_type transformType = entt::type_hash<Transform3DComponent>::value();
+            const uint32_t rotationPath = MeowEngine::Reflection.InternPropertyPath(transformType, "RotationDegrees");
+
+            const std::size_t groupCount = PhysicsEntities.Entities.size() + PlainEntities.Entities.size();
+            if(groupCount == 0) {
+                return;
+            }
+
+            for(int i = 0; i < Settings.PropertyEditCount; i++) {
+                // a few edits land on the same property, like dragging a slider
+                const std::size_t index = (FrameIndex * 7919 + static_cast<std::size_t>(i / 2) * 104729) % groupCount;
+                const entt::entity entity = index < PhysicsEntities.Entities.size()
+                        ? PhysicsEntities.Entities[index]
+                        : PlainEntities.Entities[index - PhysicsEntities.Entities.size()];
+
+                MeowEngine::PropertyChangePtr change = MeowEngine::PropertyChangePool::Get().Acquire();
+                change->SetValue(static_cast<float>(i));
+                change->EntityId = static_cast<int>(entity);
+                change->ComponentType = transformType;
+                change->PathId = rotationPath;
+
+                Buffer->GetPropertyChangeQueue().Push(std::move(change));
+            }
+        }
+
+        const MeowEngine::EnttBufferBenchmarkSettings& Settings;
+        const std::size_t EntityCount;
+
+        std::unique_ptr<MeowEngine::EnttBuffer> Buffer;
+        BenchmarkPhysics Physics;
+
+        // shared by every collider, like the cube archetype of MainScene
+        BoxColliderData ColliderData;
+
+        EntityGroup PhysicsEntities;
+        EntityGroup PlainEntities;
+        std::size_t PhysicsMoveCursor = 0;
+
+        std::vector<MeowEngine::FrameTimeStatistics> Statistics;
+        double SpawnTime;
+        std::size_t FrameIndex;
+    };
+}
+
+MeowEngine::EnttBufferBenchmarkSettings MeowEngine::EnttBufferBenchmarkSettings::Parse(int inArgumentCount, char* inArguments[]) {
+    EnttBufferBenchmarkSettings settings;
+
+    for(int i = 1; i < inArgumentCount; i++) {
+        const std::string argument = inArguments[i];
+        const bool hasValue = i + 1 < inArgumentCount;
+
+        if(argument == "--entities" && hasValue) {
+            settings.EntityCounts.clear();
+
+            std::stringstream counts(inArguments[++i]);
+            std::string count;
+            while(std::getline(counts, count, ',')) {
+                const long long entityCount = std::atoll(count.c_str());
+                if(entityCount > 0) {
+                    settings.EntityCounts.push_back(static_cast<std::size_t>(entityCount));
+                }
+            }
+        }
+        else if(argument == "--frames" && hasValue) {
+            settings.FrameCount = std::max(std::atoi(inArguments[++i]), 1);
+        }
+        else if(argument == "--warmup" && hasValue) {
+            settings.WarmupFrameCount = std::max(std::atoi(inArguments[++i]), 0);
+        }
+        else if(argument == "--physics-ratio" && hasValue) {
+            settings.PhysicsRatio = ::ParseRatio(inArguments[++i], settings.PhysicsRatio);
+        }
+        else if(argument == "--main-change" && hasValue) {
+            settings.MainChangeRatio = ::ParseRatio(inArguments[++i], settings.MainChangeRatio);
+        }
+        else if(argument == "--physics-change" && hasValue) {
+            settings.PhysicsChangeRatio = ::ParseRatio(inArguments[++i], settings.PhysicsChangeRatio);
+        }
+        else if(argument == "--churn" && hasValue) {
+            settings.ChurnRatio = ::ParseRatio(inArguments[++i], settings.ChurnRatio);
+        }
+        else if(argument == "--property-edits" && hasValue) {
+            settings.PropertyEditCount = std::max(std::atoi(inArguments[++i]), 0);
+        }
+        else if(argument == "--output" && hasValue) {
+            settings.OutputPath = inArguments[++i];
+        }
+        else {
+            MeowEngine::Log("EnttBuffer Benchmark", "Unknown argument " + argument);
+        }
+    }
+
+    return settings;
+}
+
+bool MeowEngine::EnttBufferBenchmark::Run(const MeowEngine::EnttBufferBenchmarkSettings& inSettings) {
+    // property edits are applied through reflection, same as ui edits
+    REGISTER_ENTT_COMPONENT(Transform3DComponent);
+
+    std::stringstream json;
+    json << "{\n"
+         << "  \"benchmark\": \"entt_buffer_sync\",\n"
+         << "  \"settings\": {"
+         << "\"frames\": " << inSettings.FrameCount
+         << ", \"warmup\": " << inSettings.WarmupFrameCount
+         << ", \"physics_ratio\": " << inSettings.PhysicsRatio
+         << ", \"main_change\": " << inSettings.MainChangeRatio
+         << ", \"physics_change\": " << inSettings.PhysicsChangeRatio
+         << ", \"churn\": " << inSettings.ChurnRatio
+         << ", \"property_edits\": " << inSettings.PropertyEditCount
+         << "},\n"
+         << "  \"runs\": [\n";
+
+    for(std::size_t i = 0; i < inSettings.EntityCounts.size(); i++) {
+        // one run at a time, registries of a million entities aren't kept around
+        BenchmarkRun run(inSettings, inSettings.EntityCounts[i]);
+        run.Run();
+
+        run.WriteJson(json);
+        json << (i + 1 < inSettings.EntityCounts.size() ? ",\n" : "\n");
+
+        if(!inSettings.OutputPath.empty()) {
+            run.Print();
+        }
+    }
+
+    json << "  ]\n"
+         << "}\n";
+
+    if(inSettings.OutputPath.empty()) {
+        std::fputs(json.str().c_str(), stdout);
+        return true;
+    }
+
+    std::FILE* file = std::fopen(inSettings.OutputPath.c_str(), "w");
+    if(file == nullptr) {
+        MeowEngine::Log("EnttBuffer Benchmark", "Can't write " + inSettings.OutputPath);
+        return false;
+    }
+
+    std::fputs(json.str().c_str(), file);
+    std::fclose(file);
+
+    return true;
+}
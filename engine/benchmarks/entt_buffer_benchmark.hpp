@@ -0,0 +1,51 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_ENTT_BUFFER_BENCHMARK_HPP
+#define MEOWENGINE_ENTT_BUFFER_BENCHMARK_HPP
+
+#include "string"
+#include "vector"
+#include "cstddef"
+
+namespace MeowEngine {
+    /**
+     * Run options read from command line
+     *  --entities <a,b,..>         entity counts to run, one registry set per count
+     *  --frames <count>            measured frames per entity count
+     *  --warmup <count>            frames run before measuring
+     *  --physics-ratio <0-1>       share of entities with collider & rigidbody, the rest only has life object & transform
+     *  --main-change <0-1>         share of entities main moves every frame, mailed to physics as deltas
+     *  --physics-change <0-1>      share of physics entities physics moves every frame
+     *  --churn <0-1>               share of entities removed & spawned again every frame
+     *  --property-edits <count>    ui property edits every frame
+     *  --output <path>             json results, stdout when not given
+     */
+    struct EnttBufferBenchmarkSettings {
+        std::vector<std::size_t> EntityCounts = {1000, 10000, 100000, 1000000};
+        int FrameCount = 60;
+        int WarmupFrameCount = 5;
+        float PhysicsRatio = 0.5f;
+        float MainChangeRatio = 0.01f;
+        float PhysicsChangeRatio = 0.1f;
+        float ChurnRatio = 0.001f;
+        int PropertyEditCount = 16;
+        std::string OutputPath;
+
+        static EnttBufferBenchmarkSettings Parse(int inArgumentCount, char* inArguments[]);
+    };
+
+    struct EnttBufferBenchmark {
+        /**
+         * Runs MainScene's sync pipeline on synthetic registries & times every EnttBuffer stage on its own.
+         * Main, physics & render sides run one after another on the calling thread, so stages don't fight over cores.
+         * Physics is a stand in that moves staging transforms, so neither SDL / GL nor a PhysX scene are needed
+         * & it can be run on build agents.
+         * @return false when results couldn't be written
+         */
+        static bool Run(const EnttBufferBenchmarkSettings& inSettings);
+    };
+}
+
+#endif //MEOWENGINE_ENTT_BUFFER_BENCHMARK_HPP
@@ -0,0 +1,12 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "entt_buffer_benchmark.hpp"
+
+// Headless EnttBuffer sync benchmark, see EnttBufferBenchmarkSettings for options
+int main(int argc, char* argv[]) {
+    const MeowEngine::EnttBufferBenchmarkSettings settings = MeowEngine::EnttBufferBenchmarkSettings::Parse(argc, argv);
+
+    return MeowEngine::EnttBufferBenchmark::Run(settings) ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "component_sync_traits.hpp"
+
+bool MeowEngine::IsPhysicsComponent(entt::id_type inComponentType) {
+    return PhysicsComponents::ContainsType(inComponentType);
+}
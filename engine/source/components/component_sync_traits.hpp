@@ -0,0 +1,48 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_COMPONENT_SYNC_TRAITS_HPP
+#define MEOWENGINE_COMPONENT_SYNC_TRAITS_HPP
+
+#include "sync_traits.hpp"
+#include "transform3d_component.hpp"
+#include "rigidbody_component.hpp"
+#include "collider_component.hpp"
+
+namespace MeowEngine {
+    /**
+     * Main moves transforms, physics moves rigidbodies. Main's move goes to the rigidbody as delta,
+     * physics poses used for interpolation are physics only.
+     */
+    template<>
+    struct SyncTraits<entity::Transform3DComponent> {
+        using Fields = std::tuple<
+            SyncField<&entity::Transform3DComponent::Position, SyncPolicy::DeltaMerge, entity::RigidbodyComponent>,
+            SyncField<&entity::Transform3DComponent::PreviousPhysicsPosition, SyncPolicy::OwnerWins>,
+            SyncField<&entity::Transform3DComponent::PhysicsPosition, SyncPolicy::OwnerWins>
+        >;
+    };
+
+    /**
+     * Physics builds bodies from these & moves them, render / editor only components stay off staging.
+     * StagingTraits & IsPhysicsComponent are both built from this list, new physics components only go here.
+     */
+    using PhysicsComponents = ComponentList<
+        entity::Transform3DComponent,
+        entity::ColliderComponent,
+        entity::RigidbodyComponent
+    >;
+
+    template<typename ComponentType> requires PhysicsComponents::Contains<ComponentType>
+    struct StagingTraits<ComponentType> {
+        static constexpr bool IsStaged = true;
+    };
+
+    /**
+     * Same as StagingTraits<T>::IsStaged, for staging commands & removals that only carry the type hash
+     */
+    bool IsPhysicsComponent(entt::id_type inComponentType);
+}
+
+#endif //MEOWENGINE_COMPONENT_SYNC_TRAITS_HPP
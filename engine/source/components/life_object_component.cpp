@@ -12,6 +12,10 @@ void MeowEngine::entity::LifeObjectComponent::Reflect() {
     MeowEngine::Log("Reflected", "LifeObjectComponent");
 }
 
+MeowEngine::entity::LifeObjectComponent MeowEngine::entity::LifeObjectComponent::CreateReflectionPrototype() {
+    return LifeObjectComponent("");
+}
+
 MeowEngine::entity::LifeObjectComponent::LifeObjectComponent(std::string name)
 : Name(name)
 //, Id(MeowEngine::entity::LifeObjectComponent::s_GetNewId())
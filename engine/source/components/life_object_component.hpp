@@ -12,6 +12,11 @@ namespace MeowEngine::entity {
     public:
         static void Reflect();
 
+        /**
+         * Member offsets for reflection are measured on this
+         */
+        static LifeObjectComponent CreateReflectionPrototype();
+
         LifeObjectComponent(std::string name);
 
 //        int Id;
@@ -16,10 +16,29 @@ void MeowEngine::entity::DummyClass::Reflect() {
 void MeowEngine::entity::MeshRenderComponent::Reflect() {
     REGISTER_PROPERTY(MeshRenderComponent, Data, DummyClass);
 
+    // not editable, only saved with the scene
+    REGISTER_PROPERTY(MeshRenderComponent, Shader, MeowEngine::assets::ShaderPipelineType);
+    REGISTER_PROPERTY(MeshRenderComponent, Mesh, MeowEngine::assets::StaticMeshType);
+    REGISTER_PROPERTY(MeshRenderComponent, Texture, MeowEngine::assets::TextureType);
+
     MeowEngine::Log("Reflected", "MeshRenderComponent");
 }
 
+MeshRenderComponent MeshRenderComponent::CreateReflectionPrototype() {
+    return MeshRenderComponent();
+}
+
+MeshRenderComponent::MeshRenderComponent()
+    : MeshInstance(nullptr)
+    , Mesh()
+    , Texture()
+    , Data() {
+}
+
 MeshRenderComponent::MeshRenderComponent(MeowEngine::assets::ShaderPipelineType shader, MeowEngine::StaticMeshInstance *meshInstance)
-    : MeshInstance(meshInstance), Data() {
+    : MeshInstance(meshInstance)
+    , Mesh(meshInstance->GetMesh())
+    , Texture(meshInstance->GetTexture())
+    , Data() {
     Shader = shader;
 }
\ No newline at end of file
@@ -22,6 +22,11 @@ namespace MeowEngine::entity {
     public:
         static void Reflect();
 
+        /**
+         * Member offsets for reflection are measured on this, it has no mesh instance
+         */
+        static MeshRenderComponent CreateReflectionPrototype();
+
         explicit MeshRenderComponent(MeowEngine::assets::ShaderPipelineType shader, MeowEngine::StaticMeshInstance* meshInstance);
 
 //        void Update(const glm::mat4 &projectionViewMatrix) override {
@@ -33,10 +38,23 @@ namespace MeowEngine::entity {
             return *MeshInstance;
         }
 
+        // cached from mesh instance, so render extraction doesn't chase the instance pointer per entity
+        MeowEngine::assets::StaticMeshType GetMesh() const {
+            return Mesh;
+        }
+
+        MeowEngine::assets::TextureType GetTexture() const {
+            return Texture;
+        }
+
         DummyClass Data;
 
     private:
+        MeshRenderComponent();
+
         MeowEngine::StaticMeshInstance* MeshInstance;
+        MeowEngine::assets::StaticMeshType Mesh;
+        MeowEngine::assets::TextureType Texture;
     };
 }
 
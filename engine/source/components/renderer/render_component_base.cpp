@@ -4,11 +4,12 @@
 
 #include "render_component_base.hpp"
 #include <log.hpp>
+#include "entt_reflection_wrapper.hpp"
 
 using MeowEngine::entity::RenderComponentBase;
 
 void MeowEngine::entity::RenderComponentBase::Reflect() {
-//    REGISTER_PROPERTY(Transform3DComponent, Position, MeowEngine::math::Vector3);
+    REGISTER_PROPERTY(RenderComponentBase, Shader, MeowEngine::assets::ShaderPipelineType);
 
     MeowEngine::Log("Reflected", "RenderComponentBase");
 }
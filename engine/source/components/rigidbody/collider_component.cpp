@@ -4,15 +4,20 @@
 
 #include "collider_component.hpp"
 #include <log.hpp>
+#include "entt_reflection_wrapper.hpp"
 
 using namespace MeowEngine::entity;
 
 void MeowEngine::entity::ColliderComponent::Reflect(){
-//    REGISTER_PROPERTY(RigidbodyComponent, Position, MeowEngine::math::Vector3);
+    REGISTER_PROPERTY(ColliderComponent, Type, entity::ColliderType);
 
     MeowEngine::Log("Reflected", "ColliderComponent");
 }
 
+ColliderComponent ColliderComponent::CreateReflectionPrototype() {
+    return ColliderComponent(entity::ColliderType::BOX, nullptr);
+}
+
 ColliderComponent::ColliderComponent(entity::ColliderType inType, entity::BoxColliderData* inData) {
     Type = inType;
     Data = inData;
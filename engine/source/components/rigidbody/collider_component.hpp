@@ -17,6 +17,11 @@ namespace MeowEngine::entity {
     public:
         static void Reflect();
 
+        /**
+         * Member offsets for reflection are measured on this
+         */
+        static ColliderComponent CreateReflectionPrototype();
+
         ColliderComponent(entity::ColliderType inType, entity::BoxColliderData* inData);
         virtual ~ColliderComponent() = default;
 
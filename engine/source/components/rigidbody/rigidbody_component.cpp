@@ -11,45 +11,84 @@ void MeowEngine::entity::RigidbodyComponent::Reflect(){
     MeowEngine::Log("Reflected", "RigidbodyComponent");
 }
 
-MeowEngine::entity::RigidbodyComponent::RigidbodyComponent() {
+MeowEngine::entity::RigidbodyComponent::RigidbodyComponent()
+: DynamicBody(nullptr)
+, HasPreviousPose(false) {
 
 }
 
 void MeowEngine::entity::RigidbodyComponent::SetPhysicsBody(physx::PxRigidDynamic *inBody) {
     DynamicBody = inBody;
+
+    // delta recorded before the body was created
+    if(DynamicBody != nullptr && Delta != MeowEngine::math::Vector3()) {
+        AddDelta(MeowEngine::math::Vector3());
+    }
+}
+
+physx::PxRigidDynamic* MeowEngine::entity::RigidbodyComponent::GetPhysicsBody() const {
+    return DynamicBody;
 }
 
-void RigidbodyComponent::UpdateTransform(Transform3DComponent &inTransform) {
+bool RigidbodyComponent::UpdateTransform(Transform3DComponent &inTransform) {
+    // body is created on physics thread after the component, or released with a removed physics component
+    if(DynamicBody == nullptr) {
+        return false;
+    }
+
+    const MeowEngine::math::Vector3 lastPosition = inTransform.Position;
+    const MeowEngine::math::Vector3 lastPreviousPosition = inTransform.PreviousPhysicsPosition;
+
     auto pose = DynamicBody->getGlobalPose();
-    inTransform.Position.X = pose.p.x + Delta.X;
-    inTransform.Position.Y = pose.p.y + Delta.Y;
-    inTransform.Position.Z = pose.p.z + Delta.Z;
+    inTransform.Position.X = pose.p.x;
+    inTransform.Position.Y = pose.p.y;
+    inTransform.Position.Z = pose.p.z;
 
-    Delta.X = 0;
-    Delta.Y = 0;
-    Delta.Z = 0;
+    // a body asleep until the last step hasn't moved since it was last published
+    inTransform.PreviousPhysicsPosition = HasPreviousPose ? PreviousPosition : inTransform.PhysicsPosition;
+    inTransform.PhysicsPosition = inTransform.Position;
+    HasPreviousPose = false;
 
-    DynamicBody->setGlobalPose(physx::PxTransform(inTransform.Position.X,inTransform.Position.Y,inTransform.Position.Z));
+    return lastPosition != inTransform.Position || lastPreviousPosition != inTransform.PreviousPhysicsPosition;
 }
 
-void RigidbodyComponent::OverrideTransform(Transform3DComponent &inTransform) {
-    DynamicBody->setGlobalPose(physx::PxTransform(inTransform.Position.X,inTransform.Position.Y,inTransform.Position.Z));
+void RigidbodyComponent::CapturePreviousPose() {
+    if(DynamicBody == nullptr) {
+        return;
+    }
+
+    auto pose = DynamicBody->getGlobalPose();
+    PreviousPosition.X = pose.p.x;
+    PreviousPosition.Y = pose.p.y;
+    PreviousPosition.Z = pose.p.z;
+    HasPreviousPose = true;
 }
 
-void MeowEngine::entity::RigidbodyComponent::CacheDelta(MeowEngine::math::Vector3 inDelta) {
-    CachedDelta.X += inDelta.X;
-    CachedDelta.Y += inDelta.Y;
-    CachedDelta.Z += inDelta.Z;
+void RigidbodyComponent::OverrideTransform(Transform3DComponent &inTransform) {
+    if(DynamicBody == nullptr) {
+        return;
+    }
+
+    DynamicBody->setGlobalPose(physx::PxTransform(inTransform.Position.X,inTransform.Position.Y,inTransform.Position.Z));
 }
 
 void MeowEngine::entity::RigidbodyComponent::AddDelta(MeowEngine::math::Vector3 inDelta) {
-    Delta.X += inDelta.X + CachedDelta.X;
-    Delta.Y += inDelta.Y + CachedDelta.Y;
-    Delta.Z += inDelta.Z + CachedDelta.Z;
+    Delta.X += inDelta.X;
+    Delta.Y += inDelta.Y;
+    Delta.Z += inDelta.Z;
 
-    CachedDelta.X = 0;
-    CachedDelta.Y = 0;
-    CachedDelta.Z = 0;
+    if(DynamicBody == nullptr) {
+        return;
+    }
+
+    // the only place the body gets a pose from outside, rotation is kept
+    physx::PxTransform pose = DynamicBody->getGlobalPose();
+    pose.p += physx::PxVec3(Delta.X, Delta.Y, Delta.Z);
+    DynamicBody->setGlobalPose(pose);
+
+    Delta.X = 0;
+    Delta.Y = 0;
+    Delta.Z = 0;
 
 //    MeowEngine::Log("Main Thread Delta Sync Write", TestDelta);
 }
@@ -19,10 +19,11 @@ namespace MeowEngine::entity {
         virtual ~RigidbodyComponent() = default;
 
         /**
-         * update transform using rigidbody transform
+         * update transform using rigidbody transform, only reads the body
          * @param inTransform
+         * @return true if any published pose moved, resting bodies & ones without a body return false
          */
-        void UpdateTransform(entity::Transform3DComponent& inTransform);
+        bool UpdateTransform(entity::Transform3DComponent& inTransform);
 
         /**
          * update rigidbody transform using transform
@@ -30,14 +31,26 @@ namespace MeowEngine::entity {
          */
         void OverrideTransform(entity::Transform3DComponent& inTransform);
 
+        /**
+         * cache rigidbody pose before the last physics step of a frame, published with UpdateTransform for interpolation
+         */
+        void CapturePreviousPose();
+
+        /**
+         * Moves the body by main thread's edit, wakes it up if it was sleeping.
+         * Held until the body exists when it isn't created yet.
+         */
         void AddDelta(MeowEngine::math::Vector3 inDelta);
-        void CacheDelta(MeowEngine::math::Vector3 inDelta);
         void SetPhysicsBody(physx::PxRigidDynamic* inBody);
+        physx::PxRigidDynamic* GetPhysicsBody() const;
 
     private:
         physx::PxRigidDynamic* DynamicBody;
         MeowEngine::math::Vector3 Delta;
-        MeowEngine::math::Vector3 CachedDelta;
+        MeowEngine::math::Vector3 PreviousPosition;
+
+        // set by CapturePreviousPose, bodies that were asleep before the last step use their last published pose
+        bool HasPreviousPose;
     };
 }
 
@@ -11,13 +11,18 @@ using MeowEngine::entity::Transform3DComponent;
 
 void MeowEngine::entity::Transform3DComponent::Reflect() {
     REGISTER_PROPERTY(Transform3DComponent, Position, MeowEngine::math::Vector3);
-//    REGISTER_PROPERTY(Transform3DComponent, Scale, glm::vec3);
+    REGISTER_PROPERTY(Transform3DComponent, Scale, glm::vec3);
+    REGISTER_PROPERTY(Transform3DComponent, RotationAxis, glm::vec3);
 
     REGISTER_PROPERTY(Transform3DComponent, RotationDegrees, float);
 
     MeowEngine::Log("Reflected", "Transform3DComponent");
 }
 
+Transform3DComponent Transform3DComponent::CreateReflectionPrototype() {
+    return Transform3DComponent(glm::mat4(1.0f));
+}
+
 Transform3DComponent::Transform3DComponent(const glm::mat4& inProjectionMatrix)
     : Position({0,0,0})
 //    , PositionTest({1,1,1})
@@ -26,7 +31,8 @@ Transform3DComponent::Transform3DComponent(const glm::mat4& inProjectionMatrix)
     , RotationAxis(glm::vec3(0,1,0))
     , RotationDegrees(0)
     , IdentityMatrix(glm::mat4(1.0f))
-    , TransformMatrix(IdentityMatrix) {
+    , TransformMatrix(IdentityMatrix)
+    , RandomState(2463534242u) {
     CalculateTransformMatrix(inProjectionMatrix);
 }
 
@@ -37,7 +43,8 @@ Transform3DComponent::Transform3DComponent(const glm::mat4& inProjectionMatrix,
     , RotationAxis(glm::vec3(0,1,0))
     , RotationDegrees(0)
     , IdentityMatrix(glm::mat4(1.0f))
-    , TransformMatrix(IdentityMatrix) {
+    , TransformMatrix(IdentityMatrix)
+    , RandomState(2463534242u) {
     CalculateTransformMatrix(inProjectionMatrix);
 }
 
@@ -49,7 +56,8 @@ Transform3DComponent::Transform3DComponent(const glm::mat4& inProjectionMatrix,
     , RotationAxis(rotationAxis)
     , RotationDegrees(rotationDegrees)
     , IdentityMatrix(glm::mat4(1.0f))
-    , TransformMatrix(IdentityMatrix) {
+    , TransformMatrix(IdentityMatrix)
+    , RandomState(2463534242u) {
     CalculateTransformMatrix(inProjectionMatrix);
 }
 
@@ -60,8 +68,42 @@ void Transform3DComponent::CalculateTransformMatrix(const glm::mat4 &inProjectio
                       * glm::scale(IdentityMatrix, Scale);
 }
 
+void Transform3DComponent::CalculateTransformMatrix(const glm::mat4 &inProjectionMatrix, const float &inPhysicsAlpha) {
+    // transforms without rigidbody keep both poses at zero, so offset is zero
+    const MeowEngine::math::Vector3 renderPosition = Position + (PreviousPhysicsPosition - PhysicsPosition) * (1.0f - inPhysicsAlpha);
+
+    TransformMatrix = inProjectionMatrix
+                      * glm::translate(IdentityMatrix, glm::vec3(renderPosition.X, renderPosition.Y, renderPosition.Z))
+                      * glm::rotate(IdentityMatrix, glm::radians(RotationDegrees), RotationAxis)
+                      * glm::scale(IdentityMatrix, Scale);
+}
+
+glm::mat4 Transform3DComponent::CalculateModelMatrix(const float &inPhysicsAlpha) const {
+    const MeowEngine::math::Vector3 renderPosition = Position + (PreviousPhysicsPosition - PhysicsPosition) * (1.0f - inPhysicsAlpha);
+
+    return glm::translate(IdentityMatrix, glm::vec3(renderPosition.X, renderPosition.Y, renderPosition.Z))
+           * glm::rotate(IdentityMatrix, glm::radians(RotationDegrees), RotationAxis)
+           * glm::scale(IdentityMatrix, Scale);
+}
+
+void Transform3DComponent::SeedRandomOnConstruct(entt::registry& inRegistry, entt::entity inEntity) {
+    // murmur3 finalizer, neighbouring ids end up far apart. xorshift never leaves a zero state, so it's skipped
+    uint32_t seed = static_cast<uint32_t>(entt::to_integral(inEntity)) + 1u;
+    seed ^= seed >> 16;
+    seed *= 0x85ebca6bu;
+    seed ^= seed >> 13;
+    seed *= 0xc2b2ae35u;
+    seed ^= seed >> 16;
+
+    inRegistry.get<Transform3DComponent>(inEntity).RandomState = seed != 0 ? seed : 2463534242u;
+}
+
 void Transform3DComponent::Update(const float& deltaTime) {
-    float random = (float)std::rand() / RAND_MAX;
+    // xorshift on per component state, rand() shares state between update workers
+    RandomState ^= RandomState << 13;
+    RandomState ^= RandomState >> 17;
+    RandomState ^= RandomState << 5;
+    float random = (float)(RandomState & 0xFFFFFF) / 0xFFFFFF;
     Position.Y += 1.2f * deltaTime;
 
     RotateBy(1.0f * random * 0.2f);
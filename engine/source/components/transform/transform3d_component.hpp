@@ -7,18 +7,42 @@
 
 #include "transform_component_base.hpp"
 #include "math_wrapper.hpp"
+#include "entt_wrapper.hpp"
+#include "cstdint"
 
 namespace MeowEngine::entity {
     class Transform3DComponent : public MeowEngine::entity::TransformComponentBase {
     public:
         static void Reflect();
 
+        /**
+         * Member offsets for reflection are measured on this
+         */
+        static Transform3DComponent CreateReflectionPrototype();
+
         Transform3DComponent(const glm::mat4& inProjectionMatrix);
         Transform3DComponent(const glm::mat4& inProjectionMatrix, glm::vec3 position, glm::vec3 scale, glm::vec4 rotation);
         Transform3DComponent(const glm::mat4& inProjectionMatrix, glm::vec3 position, glm::vec3 scale, glm::vec3 rotationAxis, float rotationDegrees);
 
         void CalculateTransformMatrix(const glm::mat4& inProjectionMatrix);
 
+        /**
+         * Same as above but draws rigidbodies between their last two physics poses
+         * @param inPhysicsAlpha how far render is from previous to latest physics pose, 0 - 1
+         */
+        void CalculateTransformMatrix(const glm::mat4& inProjectionMatrix, const float& inPhysicsAlpha);
+
+        /**
+         * Interpolated model matrix without camera, so it only changes when the transform does
+         */
+        glm::mat4 CalculateModelMatrix(const float& inPhysicsAlpha) const;
+
+        /**
+         * Seeds rotation jitter from the entity id, connect to on_construct of registries that run Update.
+         * Batch spawns copy one archetype transform, so a seed set in the constructor would be shared by all of them.
+         */
+        static void SeedRandomOnConstruct(entt::registry& inRegistry, entt::entity inEntity);
+
         void Update(const float& deltaTime) override;
         void RotateBy(const float& degrees);
 
@@ -32,6 +56,13 @@ namespace MeowEngine::entity {
 
         glm::mat4 IdentityMatrix;
         glm::mat4 TransformMatrix;
+
+        // last two published physics poses, render only offsets by their difference so main thread deltas stay intact
+        MeowEngine::math::Vector3 PreviousPhysicsPosition;
+        MeowEngine::math::Vector3 PhysicsPosition;
+
+        // random rotation jitter seed, kept per component so updates can run on any worker
+        uint32_t RandomState;
     };
 }
 
@@ -50,6 +50,30 @@ namespace MeowEngine::math {
             };
         }
 
+        Vector3 operator+(const Vector3& in) const {
+            return {
+                X + in.X,
+                Y + in.Y,
+                Z + in.Z
+            };
+        }
+
+        Vector3 operator*(float in) const {
+            return {
+                X * in,
+                Y * in,
+                Z * in
+            };
+        }
+
+        bool operator==(const Vector3& in) const {
+            return X == in.X && Y == in.Y && Z == in.Z;
+        }
+
+        bool operator!=(const Vector3& in) const {
+            return !(*this == in);
+        }
+
     };
 }
 
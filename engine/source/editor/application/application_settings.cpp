@@ -0,0 +1,62 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "application_settings.hpp"
+#include "log.hpp"
+
+#include <cstdlib>
+#include <algorithm>
+
+MeowEngine::ApplicationSettings MeowEngine::ApplicationSettings::Parse(int inArgumentCount, char* inArguments[]) {
+    ApplicationSettings settings;
+
+    for(int i = 1; i < inArgumentCount; i++) {
+        const std::string argument = inArguments[i];
+        const bool hasValue = i + 1 < inArgumentCount;
+
+        if(argument == "--headless") {
+            settings.IsHeadless = true;
+        }
+        else if(argument == "--frames" && hasValue) {
+            settings.HeadlessFrameCount = std::max(std::atoi(inArguments[++i]), 1);
+        }
+        else if(argument == "--timestep" && hasValue) {
+            const float timeStep = static_cast<float>(std::atof(inArguments[++i]));
+            settings.FixedTimeStep = timeStep > 0.0f ? timeStep : settings.FixedTimeStep;
+        }
+        else if(argument == "--physics-step" && hasValue) {
+            const float stepTime = static_cast<float>(std::atof(inArguments[++i]));
+            settings.PhysicsStepTime = stepTime > 0.0f ? stepTime : settings.PhysicsStepTime;
+        }
+        else if(argument == "--max-substeps" && hasValue) {
+            settings.MaxPhysicsSubstepCount = std::max(std::atoi(inArguments[++i]), 1);
+        }
+        else if(argument == "--thread-config" && hasValue) {
+            settings.Threads.LoadFile(inArguments[++i]);
+        }
+        else if(argument == "--thread" && hasValue) {
+            settings.Threads.ParseEntry(inArguments[++i]);
+        }
+        else if(argument == "--scene" && hasValue) {
+            settings.ScenePath = inArguments[++i];
+        }
+        else if(argument == "--save-scene" && hasValue) {
+            settings.SaveScenePath = inArguments[++i];
+        }
+        else if(argument == "--pacing" && hasValue) {
+            const std::string policyName = inArguments[++i];
+            if(!MeowEngine::TryParseFramePacingPolicy(policyName, settings.MainThreadPacingPolicy)) {
+                MeowEngine::Log("Application Settings", "Unknown pacing policy " + policyName);
+            }
+        }
+        else if(argument == "--benchmark-jobs") {
+            settings.ShouldRunJobBenchmark = true;
+        }
+        else {
+            MeowEngine::Log("Application Settings", "Unknown argument " + argument);
+        }
+    }
+
+    return settings;
+}
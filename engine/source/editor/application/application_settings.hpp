@@ -0,0 +1,43 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_APPLICATION_SETTINGS_HPP
+#define MEOWENGINE_APPLICATION_SETTINGS_HPP
+
+#include "string"
+#include "frame_pacing.hpp"
+#include "thread_configuration.hpp"
+
+namespace MeowEngine {
+    /**
+     * Run options read from command line
+     *  --headless              runs main & physics pipeline without window / gl context / ui
+     *  --frames <count>        frames to run in headless mode before exiting
+     *  --timestep <seconds>    fixed delta time used by main & physics in headless mode
+     *  --benchmark-jobs        runs job system scaling benchmark & exits
+     *  --pacing <policy>       main thread frame pacing, spin / sleep / hybrid
+     *  --physics-step <seconds>    fixed physics step
+     *  --max-substeps <count>      physics steps allowed per frame before extra time is dropped
+     *  --thread-config <path>      thread affinity / priority file, see ThreadConfiguration
+     *  --thread <entry>            single thread entry i.e. render:cores=1:priority=high, later entries win
+     *  --scene <path>              loads a saved scene instead of the built in one
+     *  --save-scene <path>         saves the scene once it's created or loaded
+     */
+    struct ApplicationSettings {
+        bool IsHeadless = false;
+        int HeadlessFrameCount = 1000;
+        float FixedTimeStep = 1.0f / 60.0f;
+        bool ShouldRunJobBenchmark = false;
+        FramePacingPolicy MainThreadPacingPolicy = FramePacingPolicy::Hybrid;
+        float PhysicsStepTime = 1.0f / 50.0f;
+        int MaxPhysicsSubstepCount = 4;
+        ThreadConfiguration Threads;
+        std::string ScenePath;
+        std::string SaveScenePath;
+
+        static ApplicationSettings Parse(int inArgumentCount, char* inArguments[]);
+    };
+}
+
+#endif //MEOWENGINE_APPLICATION_SETTINGS_HPP
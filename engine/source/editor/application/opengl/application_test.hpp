@@ -23,9 +23,14 @@
 #include <frame_rate_counter.hpp>
 #include "sdl_window.hpp"
 #include "SDL_image.h"
-#include "thread_barrier.hpp"
-#include "queue"
-#include "double_buffer.hpp"
+#include "frame_barrier.hpp"
+#include "job_system.hpp"
+#include "application_settings.hpp"
+#include "frame_time_statistics.hpp"
+#include "fixed_timestep.hpp"
+#include "spsc_ring.hpp"
+#include "input_event.hpp"
+#include "task.hpp"
 #include "entt_reflection_wrapper.hpp"
 //#include "entt_reflection.hpp"
 
@@ -36,7 +41,17 @@ namespace MeowEngine {
 
     struct ApplicationTest {
     public:
-        ApplicationTest() {}
+        ApplicationTest(const MeowEngine::ApplicationSettings& inSettings)
+        : Settings(inSettings)
+        , MainThreadStatistics("Main Thread", inSettings.HeadlessFrameCount)
+        , RenderThreadStatistics("Render Thread", inSettings.HeadlessFrameCount)
+        , PhysicsStatistics("Physics Simulate", inSettings.HeadlessFrameCount)
+        , InputLatencyStatistics("Input To Present")
+        , MainExecutor("Main")
+        , RenderExecutor("Render")
+        , PhysicsExecutor("Physics")
+        , HeadlessFrameIndex(0)
+        , PhysicsTimestep(inSettings.PhysicsStepTime, inSettings.MaxPhysicsSubstepCount) {}
         virtual ~ApplicationTest() {}
 
         void StartApplication() {
@@ -46,6 +61,10 @@ namespace MeowEngine {
             //  emscripten_set_main_loop(emscriptenLoop, 60, 1);
             emscripten_set_main_loop_arg((em_arg_callback_func) ::EmscriptenLoop, this, 60, 1);
 #else
+            if(Settings.IsHeadless) {
+                StartHeadlessApplication();
+                return;
+            }
 
             MeowEngine::Log("Main Thread", "SDL2 Initialized");
             if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS) != 0) {
@@ -56,36 +75,45 @@ namespace MeowEngine {
                 throw std::runtime_error("Main Thread:: Could not initialize SDL2_image");
             }
 
-            ProcessThreadBarrier = std::make_shared<ThreadBarrier>(2);
-            SwapBufferThreadBarrier = std::make_shared<ThreadBarrier>(2);
+            CreateFrameSynchronization();
 
             WindowContext = std::make_unique<MeowEngine::SDLWindow>();
             AssetManager = std::make_shared<MeowEngine::OpenGLAssetManager>(MeowEngine::OpenGLAssetManager());
             UI = std::make_shared<MeowEngine::graphics::ImGuiRenderer>(WindowContext->window, WindowContext->context);
+            UI->SetSceneViewportCallbacks(
+                [this](MeowEngine::WindowSize inSize) { ResizeSceneViewport(inSize); },
+                [this](bool inIsFocused) { FocusSceneViewport(inIsFocused); }
+            );
             Renderer = std::make_unique<MeowEngine::OpenGLRenderer>(AssetManager, UI);
 
             FrameBuffer = std::make_unique<MeowEngine::graphics::OpenGLFrameBuffer>(1000,500);
             InputManager = std::make_unique<MeowEngine::input::InputManager>();
             Physics = std::make_shared<MeowEngine::simulator::PhysXPhysics>();
 
-            Scene = std::make_shared<MeowEngine::MainScene>(MeowEngine::sdl::GetWindowSize(WindowContext->window));
+            Scene = std::make_shared<MeowEngine::MainScene>(MeowEngine::sdl::GetWindowSize(WindowContext->window), Jobs);
 
             // NOTE: Clearing context in main thread before using for render thread fixes a crash
             // which occurs while drag window
             SDL_GL_MakeCurrent(WindowContext->window, nullptr);
 
-            MainThreadFrameRate = std::make_unique<FrameRateCounter>(60, 1); // 60 frames per second
-            RenderThreadFrameRate = std::make_unique<FrameRateCounter>(60, 100);
-            PhysicsThreadFrameRate = std::make_unique<FrameRateCounter>(50, 1); // per 0.02 sec
+            CreateFrameRateCounters();
 
-            // create threads and start keep infinite thread
+            // render keeps its own thread as it owns the gl context, physics runs as jobs scheduled by main thread
             RenderThread = std::thread(&MeowEngine::ApplicationTest::RenderThreadLoop, this);
-            PhysicsThread = std::thread(&MeowEngine::ApplicationTest::PhysicsThreadLoop, this);
+            StartPhysics();
+
             MainThreadLoop();
 
             // stop threads
             RenderThread.join();
-            PhysicsThread.join();
+            Jobs->Wait(PhysicsFrameCounter);
+
+            ProcessThreadBarrier->LogStatistics();
+            SwapBufferThreadBarrier->LogStatistics();
+            LogPacingStatistics();
+
+            InputLatencyStatistics.Print();
+            MeowEngine::Log("Input", "dropped events " + std::to_string(InputEvents.GetOverflowCount()));
 
             Physics.reset();
             InputManager.reset();
@@ -97,30 +125,146 @@ namespace MeowEngine {
             Renderer.reset();
             WindowContext.reset();
 
+            Scene.reset();
+            Jobs.reset();
+
             MeowEngine::Log("Application", "Ended");
 #endif
         }
 
+        /**
+         * Runs main & physics pipeline for fixed number of frames with a fixed timestep, without window / gl context / ui.
+         * Render thread is swapped with a null stage that only takes part in barriers, so buffer syncing stays the same.
+         * Prints per thread frame time statistics before exiting.
+         */
+        void StartHeadlessApplication() {
+            MeowEngine::Log("Main Thread", "Starting headless for " + std::to_string(Settings.HeadlessFrameCount) + " frames");
+
+            CreateFrameSynchronization();
+
+            InputManager = std::make_unique<MeowEngine::input::InputManager>();
+            Physics = std::make_shared<MeowEngine::simulator::PhysXPhysics>();
+            Scene = std::make_shared<MeowEngine::MainScene>(MeowEngine::sdl::GetInitialWindowSize(), Jobs);
+
+            CreateFrameRateCounters();
+
+            RenderThread = std::thread(&MeowEngine::ApplicationTest::NullRenderThreadLoop, this);
+            StartPhysics();
+
+            MainThreadLoop();
+
+            RenderThread.join();
+            Jobs->Wait(PhysicsFrameCounter);
+
+            MainThreadStatistics.Print();
+            RenderThreadStatistics.Print();
+            PhysicsStatistics.Print();
+
+            ProcessThreadBarrier->LogStatistics();
+            SwapBufferThreadBarrier->LogStatistics();
+            LogPacingStatistics();
+
+            Physics.reset();
+            InputManager.reset();
+            Scene.reset();
+            Jobs.reset();
+
+            MeowEngine::Log("Application", "Ended headless");
+        }
+
+        void CreateFrameSynchronization() {
+            Jobs = std::make_shared<MeowEngine::JobSystem>(MeowEngine::JobSystem::GetHardwareWorkerCount(), [this](int inWorkerIndex) {
+                // physics steps run on these workers, pinning them keeps steps from migrating across sockets
+                Settings.Threads.ApplyToCurrentThread("worker", "Worker " + std::to_string(inWorkerIndex), inWorkerIndex);
+            });
+
+            // both threads join up front, so main can't run ahead while render thread is still loading
+            ProcessThreadBarrier = std::make_shared<MeowEngine::FrameBarrier>("Process");
+            SwapBufferThreadBarrier = std::make_shared<MeowEngine::FrameBarrier>("Swap Buffer");
+            MainProcessBarrierId = ProcessThreadBarrier->Join("Main Thread");
+            RenderProcessBarrierId = ProcessThreadBarrier->Join("Render Thread");
+            MainSwapBufferBarrierId = SwapBufferThreadBarrier->Join("Main Thread");
+            RenderSwapBufferBarrierId = SwapBufferThreadBarrier->Join("Render Thread");
+        }
+
+        void CreateFrameRateCounters() {
+            // only main thread locks its frame rate, render is paced by swap & physics is scheduled by main
+            MainThreadFrameRate = std::make_unique<FrameRateCounter>(60, 1, Settings.MainThreadPacingPolicy); // 60 frames per second
+            RenderThreadFrameRate = std::make_unique<FrameRateCounter>(60, 100);
+            PhysicsThreadFrameRate = std::make_unique<FrameRateCounter>(50, 1); // per 0.02 sec
+        }
+
+        void StartPhysics() {
+            Jobs->Submit([this] {
+                MeowEngine::Log("Physics", "Started");
+                Physics->Create();
+            }, &PhysicsFrameCounter);
+        }
+
+        void LogPacingStatistics() const {
+            const MeowEngine::FramePacingStatistics statistics = MainThreadFrameRate->GetPacingStatistics();
+
+            MeowEngine::Log("Main Thread Pacing", std::string(MeowEngine::GetFramePacingPolicyName(MainThreadFrameRate->GetPacingPolicy()))
+                + " frames " + std::to_string(statistics.SampleCount)
+                + " mean overshoot " + std::to_string(statistics.MeanOvershoot * 1000.0) + "ms"
+                + " p99 overshoot " + std::to_string(statistics.P99Overshoot * 1000.0) + "ms"
+                + " max overshoot " + std::to_string(statistics.MaxOvershoot * 1000.0) + "ms"
+                + " spin slice " + std::to_string(statistics.SpinSlice * 1000.0) + "ms");
+
+            MeowEngine::Log("Physics Timestep", "step " + std::to_string(PhysicsTimestep.GetStepTime() * 1000.0f) + "ms"
+                + " dropped steps " + std::to_string(PhysicsTimestep.GetDroppedStepCount()));
+        }
+
+        const MeowEngine::ApplicationSettings Settings;
+
+        // only sampled in headless runs
+        MeowEngine::FrameTimeStatistics MainThreadStatistics;
+        MeowEngine::FrameTimeStatistics RenderThreadStatistics;
+        MeowEngine::FrameTimeStatistics PhysicsStatistics;
+        int HeadlessFrameIndex;
+
+        // main thread only, physics jobs get step count & step time by value
+        MeowEngine::simulator::FixedTimestep PhysicsTimestep;
+
         // multithreading
         std::atomic<bool> IsApplicationRunning;
         std::atomic<int> ThreadCount;
         std::condition_variable WaitForThreadEndCondition;
         std::mutex WaitForThreadEndMutex;
         std::atomic<bool> IsSyncingPhysicsThread;
-        std::mutex SyncPhysicMutex;
         std::unique_ptr<FrameRateCounter> MainThreadFrameRate;
 
-        std::shared_ptr<ThreadBarrier> ProcessThreadBarrier;
-        std::shared_ptr<ThreadBarrier> SwapBufferThreadBarrier;
+        std::shared_ptr<MeowEngine::FrameBarrier> ProcessThreadBarrier;
+        std::shared_ptr<MeowEngine::FrameBarrier> SwapBufferThreadBarrier;
+        int MainProcessBarrierId;
+        int RenderProcessBarrierId;
+        int MainSwapBufferBarrierId;
+        int RenderSwapBufferBarrierId;
+
+        /**
+         * Worker pool shared by main thread updates, syncing & physics frames
+         */
+        std::shared_ptr<MeowEngine::JobSystem> Jobs;
 
-        MeowEngine::DoubleBuffer<std::queue<SDL_Event>> InputBuffer = MeowEngine::DoubleBuffer<std::queue<SDL_Event>>();
+        /**
+         * Main thread polls & pushes, render thread drains as soon as it gets to it instead of waiting for buffer swap
+         */
+        MeowEngine::SpscRing<MeowEngine::input::InputEvent, 1024> InputEvents;
 
         void MainThreadLoop() {
             // init
             PT_PROFILE_SCOPE;
+            Settings.Threads.ApplyToCurrentThread("main", "Main Thread");
             MeowEngine::Log("Main Thread", "Started");
 
-            Scene->CreateSceneOnMainThread();
+            // falls back to the built in scene when the file can't be loaded
+            if(Settings.ScenePath.empty() || !Scene->LoadSceneOnMainThread(Settings.ScenePath)) {
+                Scene->CreateSceneOnMainThread();
+            }
+
+            if(!Settings.SaveScenePath.empty()) {
+                Scene->SaveSceneOnMainThread(Settings.SaveScenePath);
+            }
 
 //            MeowEngine::Log("Main Thread", "waiting for creating all threads");
 //            std::unique_lock<std::mutex> lock(WaitForThreadEndMutex);
@@ -128,12 +272,25 @@ namespace MeowEngine {
 //
 //            MeowEngine::Log("Main Thread", "Created");
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            if(!Settings.IsHeadless) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            }
 
             // loop
             while(IsApplicationRunning)
             {
                 MainThreadFrameRate->Calculate();
+                MainExecutor.RunPending();
+
+                // headless runs use a fixed step so every run simulates the same thing
+                const float deltaTime = Settings.IsHeadless ? Settings.FixedTimeStep : MainThreadFrameRate->DeltaTime;
+                if(Settings.IsHeadless && HeadlessFrameIndex > 0) {
+                    MainThreadStatistics.AddSample(MainThreadFrameRate->DeltaTime);
+                }
+
+                // editor also counts time since physics was last scheduled, headless leaves it out so runs repeat
+                const float pendingPhysicsTime = Settings.IsHeadless ? 0.0f : static_cast<float>(PhysicsThreadFrameRate->GetElapsedTime());
+                Scene->SetPhysicsInterpolation(PhysicsTimestep.GetAlpha(pendingPhysicsTime));
 
                 PT_PROFILE_SCOPE;
                 // if thread count == 0 on main notify
@@ -142,9 +299,11 @@ namespace MeowEngine {
 
 //                MeowEngine::Log("Main Thread", "Running");
 //                MeowEngine::Log("Frame Rate: ", static_cast<float>(MainThreadFrameRate->DeltaTime));
-                Update(MainThreadFrameRate->DeltaTime);
+                Update(deltaTime);
+
+                SchedulePhysicsFrame();
 
-                if(!Input(MainThreadFrameRate->DeltaTime))
+                if(!ShouldContinueRunning(deltaTime))
                 {
                     PT_PROFILE_SCOPE_N("Main Thread Ending");
                     IsApplicationRunning = false;
@@ -168,39 +327,25 @@ namespace MeowEngine {
 
                 // wait for all threads to sync up for frame ending
 
-                ProcessThreadBarrier.get()->Wait();
+                ProcessThreadBarrier->Wait(MainProcessBarrierId);
 
 
 //                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
 
-                // swap buffers
-                InputBuffer.Swap();
-
-                // swap
-                // delta add to final rigidbody all frames after main thread calculations
-                // delta is buffered 3 ways
-                // write from main thread on this
-                // read from render thread on this
-
-                // staging accesses final rigidbody takes the delta
-                if(SyncPhysicMutex.try_lock()) {
-                    Scene->SyncPhysicsBufferOnMainThread(false);
-                    SyncPhysicMutex.unlock();
+                // headless lets physics step land in the same frame every run, so results are repeatable
+                if(Settings.IsHeadless) {
+                    Jobs->Wait(PhysicsFrameCounter);
                 }
-                else {
-                    Scene->SyncPhysicsBufferOnMainThread(true);
-                }
-
 
-                Scene->SyncRenderBufferOnMainThread();
+                SyncBuffers();
 
-                Scene->SwapMainAndRenderBufferOnMainThread();
-
-                MainThreadFrameRate->LockFrameRate();
+                if(!Settings.IsHeadless) {
+                    MainThreadFrameRate->LockFrameRate();
+                }
 
                 // wait until buffers are synced
                 // ideally since other threads are waiting this should release all of them automatically
-                SwapBufferThreadBarrier.get()->Wait();
+                SwapBufferThreadBarrier->Wait(MainSwapBufferBarrierId);
             }
 
             MeowEngine::Log("Main Thread", "Waiting for other threads to end");
@@ -208,6 +353,9 @@ namespace MeowEngine {
             std::unique_lock<std::mutex> lock(WaitForThreadEndMutex);
             WaitForThreadEndCondition.wait(lock, [this] { return ThreadCount == 0;});
 
+            // let the running physics frame finish before physics gets destroyed
+            Jobs->Wait(PhysicsFrameCounter);
+
             MeowEngine::Log("Main Thread", "Ended");
         }
 
@@ -216,6 +364,7 @@ namespace MeowEngine {
         void RenderThreadLoop() {
 
             // init
+            Settings.Threads.ApplyToCurrentThread("render", "Render Thread");
             MeowEngine::Log("Render Thread", "Started");
             ThreadCount++;
 
@@ -228,28 +377,11 @@ namespace MeowEngine {
                 RenderThreadFrameRate->Calculate();
 
                 PT_PROFILE_SCOPE;
-                // Synchronize with the main thread
                 // input
-                while(!InputBuffer.GetFinal().empty()) {
-                    SDL_Event event = InputBuffer.GetFinal().front();
-                    InputBuffer.GetFinal().pop();
-
-                    UI->Input(event);
-
-                    switch (event.type) {
-                        case SDL_USEREVENT:
-                            switch (event.user.code) {
-                                case 2: {
-                                    const WindowSize size = *(WindowSize *) event.user.data1;
-
-                                    glViewport(0, 0, size.Width, size.Height);
-                                    FrameBuffer->RescaleFrameBuffer(size.Width, size.Height);
-                                    MeowEngine::Log("Render Thread", "rescale userevent");
-                                    break;
-                                }
-                            }
-                    }
-                }
+                ProcessInputEventsOnRenderThread();
+
+                // tasks that hopped to render since last frame, i.e. viewport rescale
+                RenderExecutor.RunPending();
 
                 // Clear frame
                 //  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -263,6 +395,11 @@ namespace MeowEngine {
                     // Swap buffers
                     SDL_GL_SwapWindow(WindowContext->window);
                 }
+
+                if(OldestInputTimestamp != 0) {
+                    InputLatencyStatistics.AddSample((double) (SDL_GetPerformanceCounter() - OldestInputTimestamp) / SDL_GetPerformanceFrequency());
+                    OldestInputTimestamp = 0;
+                }
 // Frame timing logic
 
 //                RenderThreadFrameRate->LockFrameRate();
@@ -278,17 +415,20 @@ namespace MeowEngine {
 //                }
                 // MeowEngine::Log("Render Thread", "Waiting for other threads to finish processing");
                 // wait for all threads to sync up for frame ending
-                ProcessThreadBarrier.get()->Wait();
+                ProcessThreadBarrier->Wait(RenderProcessBarrierId);
 
                 // MeowEngine::Log("Render Thread", "Waiting for main thread to finish swapping buffers");
                 // wait until buffers are synced on main thread
-                SwapBufferThreadBarrier.get()->Wait();
+                SwapBufferThreadBarrier->Wait(RenderSwapBufferBarrierId);
 
 
 //                RenderThreadFrameRate.End();
             }
 
             // exit
+            ProcessThreadBarrier->Leave(RenderProcessBarrierId);
+            SwapBufferThreadBarrier->Leave(RenderSwapBufferBarrierId);
+
             std::this_thread::sleep_for(std::chrono::milliseconds(500));
             ThreadCount--;
 
@@ -296,41 +436,122 @@ namespace MeowEngine {
             WaitForThreadEndCondition.notify_all();
         }
 
-        std::thread PhysicsThread;
-        std::shared_ptr<MeowEngine::simulator::Physics> Physics;
-        std::unique_ptr<FrameRateCounter> PhysicsThreadFrameRate;
-
-        void PhysicsThreadLoop() {
-            MeowEngine::Log("Physics Thread", "Started");
+        /**
+         * Null render stage for headless runs, crosses the same barriers as render thread without touching gl
+         */
+        void NullRenderThreadLoop() {
+            Settings.Threads.ApplyToCurrentThread("render", "Null Render Thread");
+            MeowEngine::Log("Null Render Thread", "Started");
+            ThreadCount++;
 
+            bool isFirstFrame = true;
 
-            ThreadCount++;
-            Physics->Create();
+            while (IsApplicationRunning) {
+                RenderThreadFrameRate->Calculate();
 
+                if(!isFirstFrame) {
+                    RenderThreadStatistics.AddSample(RenderThreadFrameRate->DeltaTime);
+                }
+                isFirstFrame = false;
 
-            while(IsApplicationRunning)
-            {
-                PhysicsThreadFrameRate->Calculate();
+                // input is never produced in headless, keep ring drained anyway
+                MeowEngine::input::InputEvent inputEvent;
+                while(InputEvents.Pop(inputEvent)) {
+                }
 
-                PT_PROFILE_SCOPE;
-                FixedUpdate(PhysicsThreadFrameRate->DeltaTime);
+                RenderExecutor.RunPending();
 
-                PhysicsThreadFrameRate->LockFrameRate();
-//                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                ProcessThreadBarrier->Wait(RenderProcessBarrierId);
+                SwapBufferThreadBarrier->Wait(RenderSwapBufferBarrierId);
             }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            ProcessThreadBarrier->Leave(RenderProcessBarrierId);
+            SwapBufferThreadBarrier->Leave(RenderSwapBufferBarrierId);
+
             ThreadCount--;
 
-            MeowEngine::Log("Physics Thread", "Ended");
+            MeowEngine::Log("Null Render Thread", "Ended");
             WaitForThreadEndCondition.notify_all();
         }
 
+        std::shared_ptr<MeowEngine::simulator::Physics> Physics;
+        std::unique_ptr<FrameRateCounter> PhysicsThreadFrameRate;
+
+        /**
+         * Physics frame job graph: add entities -> simulate -> sync, only one physics frame is in flight at a time
+         */
+        MeowEngine::JobCounter PhysicsAddEntitiesCounter;
+        MeowEngine::JobCounter PhysicsSimulateCounter;
+        MeowEngine::JobCounter PhysicsFrameCounter;
+
+        /**
+         * Called every main thread frame, queues a physics frame when previous one is done & it's time for a new step.
+         * Physics no longer owns a thread, so it doesn't burn a core waiting for its next step.
+         */
+        void SchedulePhysicsFrame() {
+            PT_PROFILE_SCOPE;
+            if(!PhysicsFrameCounter.IsDone()) {
+                return;
+            }
+
+            // time keeps adding up on the counter while previous physics frame is busy, accumulator turns it into fixed steps
+            PhysicsThreadFrameRate->Calculate();
+            const float frameTime = Settings.IsHeadless ? Settings.FixedTimeStep : PhysicsThreadFrameRate->DeltaTime;
+            const int stepCount = PhysicsTimestep.Advance(frameTime);
+
+            if(stepCount == 0) {
+                return;
+            }
+
+            const float stepTime = PhysicsTimestep.GetStepTime();
+
+            Jobs->Submit([this] {
+                PT_PROFILE_SCOPE_N("Physics Add Entities");
+                PhysicsExecutor.RunPending();
+                Scene->AddEntitiesOnPhysicsThread(Physics.get());
+            }, &PhysicsAddEntitiesCounter);
+
+            Jobs->Submit([this, stepCount, stepTime] {
+                PT_PROFILE_SCOPE_N("Physics Simulate");
+                const auto stepStartTime = std::chrono::steady_clock::now();
+
+                for(int i = 0; i < stepCount; i++) {
+                    // pose before last step is published with the latest one, render interpolates between them
+                    if(i == stepCount - 1) {
+                        Scene->CapturePreviousPhysicsPosesOnPhysicsThread(Physics.get());
+                    }
+
+                    Physics->Update(stepTime);
+                }
+
+                if(Settings.IsHeadless) {
+                    const std::chrono::duration<double> simulateTime = std::chrono::steady_clock::now() - stepStartTime;
+                    PhysicsStatistics.AddSample(simulateTime.count());
+                }
+            }, &PhysicsSimulateCounter, &PhysicsAddEntitiesCounter);
+
+            Jobs->Submit([this] {
+                PT_PROFILE_SCOPE_N("Physics Sync");
+                Scene->SyncPhysicsBufferOnPhysicsThread(Physics.get());
+            }, &PhysicsFrameCounter, &PhysicsSimulateCounter);
+        }
+
         // main thread ----------------
 
         std::unique_ptr<MeowEngine::input::InputManager> InputManager;
         std::shared_ptr<MeowEngine::Scene> Scene;
 
+        /**
+         * Editor stops on quit input, headless stops after requested frame count
+         */
+        bool ShouldContinueRunning(const float& deltaTime) {
+            if(Settings.IsHeadless) {
+                return ++HeadlessFrameIndex < Settings.HeadlessFrameCount;
+            }
+
+            return Input(deltaTime);
+        }
+
         bool Input(const float& deltaTime) {
             PT_PROFILE_SCOPE;
             SDL_Event event;
@@ -347,7 +568,8 @@ namespace MeowEngine {
             // Each loop we will process any events that are waiting for us.
             while (SDL_PollEvent(&event))
             {
-                InputBuffer.GetCurrent().push(event);
+                // dropped events are counted by the ring & logged on exit
+                InputEvents.Push({event, SDL_GetPerformanceCounter()});
 
                 switch (event.type)
                 {
@@ -373,21 +595,6 @@ namespace MeowEngine {
                         }
                         break;
 
-                    case SDL_USEREVENT:
-                        switch (event.user.code) {
-                            case 2: {
-                                MeowEngine::Log("Main Thread", "Rescaled Window");
-
-                                const WindowSize size = *(WindowSize *) event.user.data1;
-                                Scene->OnWindowResized(size);
-
-                                break;
-                            }
-                            case 3: {
-                                InputManager->isActive = *(bool *) event.user.data1;
-                                break;
-                            }
-                        }
                     default:
                         break;
                 }
@@ -406,6 +613,19 @@ namespace MeowEngine {
             Scene->Update(deltaTime);
         };
 
+        /**
+         * Syncs & swaps entt buffers, physics sync -> render sync -> swap have to stay in order so they run inline.
+         * Input doesn't go through here, it's streamed to render thread through InputEvents.
+         */
+        void SyncBuffers() {
+            PT_PROFILE_SCOPE;
+
+            // main thread deltas & physics results go through mailboxes, so this never waits on a physics frame
+            Scene->SyncPhysicsBufferOnMainThread();
+            Scene->SyncRenderBufferOnMainThread();
+            Scene->SwapMainAndRenderBufferOnMainThread();
+        }
+
         // render ----------------
         std::thread RenderThread;
         // we decouple window / context into a class
@@ -418,6 +638,53 @@ namespace MeowEngine {
         std::shared_ptr<MeowEngine::OpenGLAssetManager> AssetManager;
 
 
+        // oldest event consumed this frame, 0 when none
+        Uint64 OldestInputTimestamp = 0;
+        MeowEngine::FrameTimeStatistics InputLatencyStatistics;
+
+        /**
+         * Tasks hop onto these with co_await ResumeOn(..), each is drained once per frame by its owner
+         */
+        MeowEngine::QueueExecutor MainExecutor;
+        MeowEngine::QueueExecutor RenderExecutor;
+        MeowEngine::QueueExecutor PhysicsExecutor;
+
+        void ProcessInputEventsOnRenderThread() {
+            PT_PROFILE_SCOPE;
+            MeowEngine::input::InputEvent inputEvent;
+
+            while(InputEvents.Pop(inputEvent)) {
+                if(OldestInputTimestamp == 0) {
+                    OldestInputTimestamp = inputEvent.Timestamp;
+                }
+
+                UI->Input(inputEvent.Event);
+            }
+        }
+
+        /**
+         * Ui reports it mid draw on render thread, framebuffer is rescaled at start of next render frame
+         * & main thread camera follows once that's done
+         */
+        MeowEngine::Task ResizeSceneViewport(MeowEngine::WindowSize inSize) {
+            co_await MeowEngine::ResumeOn(RenderExecutor);
+
+            glViewport(0, 0, inSize.Width, inSize.Height);
+            FrameBuffer->RescaleFrameBuffer(inSize.Width, inSize.Height);
+            MeowEngine::Log("Render Thread", "Rescaled scene viewport");
+
+            co_await MeowEngine::ResumeOn(MainExecutor);
+
+            Scene->OnWindowResized(inSize);
+            MeowEngine::Log("Main Thread", "Rescaled Window");
+        }
+
+        MeowEngine::Task FocusSceneViewport(bool inIsFocused) {
+            co_await MeowEngine::ResumeOn(MainExecutor);
+
+            InputManager->isActive = inIsFocused;
+        }
+
         void Render() {
 
 
@@ -442,6 +709,9 @@ namespace MeowEngine {
             glClearColor(50 / 255.0f, 50 / 255.0f, 50 / 255.0f, 1.0f);
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+            // pick up events main thread polled while game view was rendering, so ui sees them this frame
+            ProcessInputEventsOnRenderThread();
+
             {
                 PT_PROFILE_SCOPE_N("UI render");
 //                MeowEngine::Log("Frame Rate: ", static_cast<int>(RenderThreadFrameRate.GetFrameRate()));
@@ -484,17 +754,6 @@ namespace MeowEngine {
 //                }
         };
 
-        // physics thread ----------------
-
-        void FixedUpdate(const float& inFixedDeltaTime) {
-            Scene->AddEntitiesOnPhysicsThread(Physics.get());
-            Physics->Update(inFixedDeltaTime);
-
-            if(SyncPhysicMutex.try_lock()) {
-                Scene->SyncPhysicsBufferOnPhysicsThread();
-                SyncPhysicMutex.unlock();
-            }
-        };
     };
 }
 
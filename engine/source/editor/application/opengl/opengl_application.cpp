@@ -100,10 +100,15 @@ namespace {
         return std::make_shared<MeowEngine::simulator::PhysXPhysics>();
     }
 
-    std::unique_ptr<MeowEngine::Scene> CreateMainScene(SDL_Window* window, MeowEngine::OpenGLAssetManager& assetManager, MeowEngine::simulator::Physics& inPhysics) {
+    std::shared_ptr<MeowEngine::JobSystem> CreateJobSystem() {
+        return std::make_shared<MeowEngine::JobSystem>(MeowEngine::JobSystem::GetHardwareWorkerCount());
+    }
+
+    std::unique_ptr<MeowEngine::Scene> CreateMainScene(SDL_Window* window, MeowEngine::OpenGLAssetManager& assetManager, MeowEngine::simulator::Physics& inPhysics, std::shared_ptr<MeowEngine::JobSystem> inJobSystem) {
         std::unique_ptr<MeowEngine::MainScene> mainScene {
             std::make_unique<MeowEngine::MainScene>(
-                MeowEngine::sdl::GetWindowSize(window)
+                MeowEngine::sdl::GetWindowSize(window),
+                std::move(inJobSystem)
             )
         };
 
@@ -126,6 +131,9 @@ struct OpenGLApplication::Internal {
     std::unique_ptr<MeowEngine::Scene> Scene;
     std::shared_ptr<MeowEngine::simulator::Physics> Physics;
 
+    // one worker pool for the application, scenes created later share it instead of starting their own threads
+    std::shared_ptr<MeowEngine::JobSystem> Jobs;
+
     Internal() : Window(MeowEngine::sdl::CreateWindow(SDL_WINDOW_RESIZABLE | SDL_WINDOW_OPENGL | SDL_WINDOW_ALLOW_HIGHDPI)) ,
                  Context(CreateContext(Window)),
                  AssetManager(::CreateAssetManager()),
@@ -133,8 +141,15 @@ struct OpenGLApplication::Internal {
                  UI(CreateUI(Window, Context)),
                  FrameBuffer(::CreateFrameBuffer()),
                  InputManager(),
-                 Physics(::CreatePhysics())
-    {}
+                 Physics(::CreatePhysics()),
+                 Jobs(::CreateJobSystem())
+    {
+        // single threaded, ui callbacks can act right away
+        UI.SetSceneViewportCallbacks(
+            [this](WindowSize inSize) { OnViewportResize(inSize); },
+            [this](bool inIsFocused) { InputManager.isActive = inIsFocused; }
+        );
+    }
 
     ~Internal() {
         SDL_GL_DeleteContext(Context);
@@ -155,7 +170,7 @@ struct OpenGLApplication::Internal {
 
     MeowEngine::Scene& GetScene() {
         if(!Scene) {
-            Scene = ::CreateMainScene(Window, *AssetManager, *Physics);
+            Scene = ::CreateMainScene(Window, *AssetManager, *Physics, Jobs);
         }
 
         return *Scene;
@@ -191,18 +206,6 @@ struct OpenGLApplication::Internal {
                     }
                     break;
 
-                case SDL_USEREVENT:
-                    switch (event.user.code) {
-                        case 2: {
-                            const WindowSize size = *(WindowSize *) event.user.data1;
-                            OnViewportResize(size);
-                            break;
-                        }
-                        case 3: {
-                            InputManager.isActive = *(bool *) event.user.data1;
-                            break;
-                        }
-                    }
                 default:
                     break;
             }
@@ -62,44 +62,26 @@ struct OpenGLRenderer::Internal {
 //        }
 //    }
 
-    void RenderGameView(MeowEngine::PerspectiveCamera* cameraObject, entt::registry& registry)
+    void RenderGameView(const MeowEngine::RenderSnapshot& inSnapshot)
     {
-//        auto view = registry.view<MeowEngine::core::component::Transform3DComponent>();
-//        for(auto entity: view)
-//        {
-//            auto transform = view.get<MeowEngine::core::component::Transform3DComponent>(entity);
-//
-//        }
-
-//        auto view = registry.view<entity::Transform3dComponent>();
-//        registry.view<MeowEngine::entity::Transform3dComponent>().each([](auto entity, auto &MeowEngine::entity::Transform3dComponent) {
-//            // ...
-//        });
-//
-//        for(auto &&[entt::entity, MeowEngine::entity::Transform3dComponent]: registry.view<entity::Transform3dComponent>().each()) {
-//            // ...
-//        }
-        for(auto &&[entity,renderComponent, transform]: registry.view<entity::MeshRenderComponent, entity::Transform3DComponent>().each())
-        {
-            AssetManager->GetShaderPipeline<OpenGLMeshPipeline>(ShaderPipelineType::Default)->Render(
-                    *AssetManager,
-                    &renderComponent,
-                    &transform
-            );
-        }
-
-        for(auto &&[entity,renderComponent, transform]: registry.view<entity::RenderComponentBase, entity::Transform3DComponent>().each())
+        AssetManager->GetShaderPipeline<OpenGLMeshPipeline>(ShaderPipelineType::Default)->Render(
+                *AssetManager,
+                inSnapshot.MeshInstances,
+                inSnapshot.ProjectionMatrix * inSnapshot.ViewMatrix
+        );
+
+        // grid is drawn from camera matrices, instance only says there is one
+        for(std::size_t i = 0; i < inSnapshot.GridInstances.size(); i++)
         {
             AssetManager->GetShaderPipeline<OpenGLGridPipeline>(ShaderPipelineType::Grid)->Render(
                     *AssetManager,
-                    &renderComponent,
-                    &transform,
-                    cameraObject
+                    inSnapshot.ViewMatrix,
+                    inSnapshot.ProjectionMatrix
             );
         }
     }
 
-    void RenderUserInterface(entt::registry& registry, std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& inUIInputQueue, unsigned int frameBufferId, const double fps) {
+    void RenderUserInterface(entt::registry& registry, MeowEngine::PropertyChangeQueue& inUIInputQueue, unsigned int frameBufferId, const double fps) {
         UI.get()->Render(registry, inUIInputQueue, frameBufferId, fps);
     }
 };
@@ -109,10 +91,10 @@ OpenGLRenderer::OpenGLRenderer(const std::shared_ptr<MeowEngine::OpenGLAssetMana
     : InternalPointer(MeowEngine::make_internal_ptr<Internal>(assetManager, uiRenderer)) {}
 
 
-void OpenGLRenderer::RenderGameView(MeowEngine::PerspectiveCamera* cameraObject, entt::registry& registry) {
-    InternalPointer->RenderGameView(cameraObject, registry);
+void OpenGLRenderer::RenderGameView(const MeowEngine::RenderSnapshot& inSnapshot) {
+    InternalPointer->RenderGameView(inSnapshot);
 }
 
-void OpenGLRenderer::RenderUserInterface(entt::registry& registry, std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& inUIInputQueue, unsigned int frameBufferId, const double fps) {
+void OpenGLRenderer::RenderUserInterface(entt::registry& registry, MeowEngine::PropertyChangeQueue& inUIInputQueue, unsigned int frameBufferId, const double fps) {
     InternalPointer->RenderUserInterface(registry, inUIInputQueue, frameBufferId, fps);
 }
\ No newline at end of file
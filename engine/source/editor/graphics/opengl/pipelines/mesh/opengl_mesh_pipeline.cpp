@@ -96,67 +96,86 @@ OpenGLMeshPipeline::~OpenGLMeshPipeline() {
 
 void OpenGLMeshPipeline::Render(
         const MeowEngine::OpenGLAssetManager &assetManager,
-        const MeowEngine::entity::MeshRenderComponent* meshRenderComponent,
-        const MeowEngine::entity::Transform3DComponent* transform3DComponent) const {
+        const std::vector<MeowEngine::RenderInstance>& instances,
+        const glm::mat4& projectionViewMatrix) const {
 
-    const MeowEngine::StaticMeshInstance& staticMeshInstance = meshRenderComponent->GetMeshInstance();
-    const MeowEngine::OpenGLMesh& mesh = assetManager.GetStaticMesh(staticMeshInstance.GetMesh());
+    if(instances.empty()) {
+        return;
+    }
 
     glUseProgram(ShaderProgramID);
-    glBindVertexArray(mesh.GetVertexArrayId());
 
-//#ifndef USING_GLES
-//        // This will render a wire frame for us :)
-//        // n just like that we can have a wire frame mode (not that i need it but yeah lol)
-//
-//        glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-//#endif
-    // Activating our vertex position attribute
-    glEnableVertexAttribArray(AttributeLocationVertexPosition);
-
-    // Activate our texture coord attribute
-    glEnableVertexAttribArray(AttributeLocationTextureCoord);
-    // end - Activate Shader Program - finish
-
-    // Populating our MVP in shader program
-    glUniformMatrix4fv(UniformLocationMVP, 1, GL_FALSE, &transform3DComponent->TransformMatrix[0][0]);
-
-    // Apply the texture we want to paint the mesh with.
-    assetManager.GetTexture(staticMeshInstance.GetTexture()).Bind();
-
-    // Bind the vertex and index buffers
-    glBindBuffer(GL_ARRAY_BUFFER, mesh.GetVertexBufferId());
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.GetIndexBufferId());
-
-    // Configuring the vertex position attribute
-    glVertexAttribPointer(
-            AttributeLocationVertexPosition,
-            3,
-            GL_FLOAT,
-            GL_FALSE,
-            Stride,
-            reinterpret_cast<const GLvoid*>(OffsetPosition) // (GLvoid*)(OffsetPosition) -> had warnings
-    );
-
-    // Config the texture coord
-    glVertexAttribPointer(
-            AttributeLocationTextureCoord,
-            2,
-            GL_FLOAT,
-            GL_FALSE,
-            Stride,
-            reinterpret_cast<const GLvoid*>(OffsetTextureCoord) // (GLvoid*)(OffsetTextureCoord) -> had warnings
-    );
-
-    // Draw command providing the total number of vertices from mesh
-    glDrawElements(
-            GL_TRIANGLES,
-            mesh.GetNumIndices(),
-            GL_UNSIGNED_INT,
-            reinterpret_cast<const GLvoid*>(0) // (GLvoid*)(0)
-    );
+    const MeowEngine::OpenGLMesh* mesh = nullptr;
+    MeowEngine::assets::StaticMeshType boundMesh = instances.front().Mesh;
+    MeowEngine::assets::TextureType boundTexture = instances.front().Texture;
+
+    for(const MeowEngine::RenderInstance& instance : instances) {
+        if(!mesh || instance.Mesh != boundMesh) {
+            if(mesh) {
+                // attributes belong to the previous vertex array
+                glDisableVertexAttribArray(AttributeLocationVertexPosition);
+                glDisableVertexAttribArray(AttributeLocationTextureCoord);
+            }
+
+            boundMesh = instance.Mesh;
+            mesh = &assetManager.GetStaticMesh(boundMesh);
+
+            glBindVertexArray(mesh->GetVertexArrayId());
+
+            // Activating our vertex position attribute
+            glEnableVertexAttribArray(AttributeLocationVertexPosition);
+
+            // Activate our texture coord attribute
+            glEnableVertexAttribArray(AttributeLocationTextureCoord);
+
+            // Bind the vertex and index buffers
+            glBindBuffer(GL_ARRAY_BUFFER, mesh->GetVertexBufferId());
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->GetIndexBufferId());
+
+            // Configuring the vertex position attribute
+            glVertexAttribPointer(
+                    AttributeLocationVertexPosition,
+                    3,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    Stride,
+                    reinterpret_cast<const GLvoid*>(OffsetPosition) // (GLvoid*)(OffsetPosition) -> had warnings
+            );
+
+            // Config the texture coord
+            glVertexAttribPointer(
+                    AttributeLocationTextureCoord,
+                    2,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    Stride,
+                    reinterpret_cast<const GLvoid*>(OffsetTextureCoord) // (GLvoid*)(OffsetTextureCoord) -> had warnings
+            );
+
+            // first draw of every mesh binds its texture as well
+            assetManager.GetTexture(instance.Texture).Bind();
+            boundTexture = instance.Texture;
+        }
+        else if(instance.Texture != boundTexture) {
+            // Apply the texture we want to paint the mesh with.
+            assetManager.GetTexture(instance.Texture).Bind();
+            boundTexture = instance.Texture;
+        }
+
+        // Populating our MVP in shader program, camera is applied here so instances only change when they move
+        const glm::mat4 mvp = projectionViewMatrix * instance.ModelMatrix;
+        glUniformMatrix4fv(UniformLocationMVP, 1, GL_FALSE, &mvp[0][0]);
+
+        // Draw command providing the total number of vertices from mesh
+        glDrawElements(
+                GL_TRIANGLES,
+                mesh->GetNumIndices(),
+                GL_UNSIGNED_INT,
+                reinterpret_cast<const GLvoid*>(0) // (GLvoid*)(0)
+        );
+    }
 
     // Disabling the vertex position attribute as we are done using it. (seems like file open - close streaming process)
     glDisableVertexAttribArray(AttributeLocationVertexPosition);
     glDisableVertexAttribArray(AttributeLocationTextureCoord);
-}
\ No newline at end of file
+}
@@ -11,6 +11,7 @@
 #include "opengl_pipeline_base.hpp"
 #include "mesh_render_component.hpp"
 #include "transform3d_component.hpp"
+#include "render_snapshot.hpp"
 
 namespace MeowEngine::pipeline {
     struct OpenGLMeshPipeline : public MeowEngine::pipeline::OpenGLPipelineBase {
@@ -18,10 +19,13 @@ namespace MeowEngine::pipeline {
         ~OpenGLMeshPipeline() override;
 
     public:
+        /**
+         * Draws snapshot instances, mesh & texture are only rebound when they change from the previous instance
+         */
         void Render(
             const MeowEngine::OpenGLAssetManager& assetManager,
-            const MeowEngine::entity::MeshRenderComponent* meshRenderComponent,
-            const MeowEngine::entity::Transform3DComponent* transform3DComponent
+            const std::vector<MeowEngine::RenderInstance>& instances,
+            const glm::mat4& projectionViewMatrix
         ) const;
 //        void Render(
 //                const MeowEngine::OpenGLAssetManager& assetManager,
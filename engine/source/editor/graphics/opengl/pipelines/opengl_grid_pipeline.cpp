@@ -18,14 +18,13 @@ OpenGLGridPipeline::~OpenGLGridPipeline() {
 
 void OpenGLGridPipeline::Render(
         const MeowEngine::OpenGLAssetManager &assetManager,
-        const MeowEngine::entity::RenderComponentBase *renderComponent,
-        const MeowEngine::entity::Transform3DComponent* transform3DComponent,
-        const MeowEngine::PerspectiveCamera* camera) const {
+        const glm::mat4& viewMatrix,
+        const glm::mat4& projectionMatrix) const {
 
     glUseProgram(ShaderProgramID);
 
-    glUniformMatrix4fv(glGetUniformLocation(ShaderProgramID, "u_view"), 1, GL_FALSE, &camera->GetViewMatrix()[0][0]);
-    glUniformMatrix4fv(glGetUniformLocation(ShaderProgramID, "u_projection"), 1, GL_FALSE, &camera->GetProjectionMatrix()[0][0]);
+    glUniformMatrix4fv(glGetUniformLocation(ShaderProgramID, "u_view"), 1, GL_FALSE, &viewMatrix[0][0]);
+    glUniformMatrix4fv(glGetUniformLocation(ShaderProgramID, "u_projection"), 1, GL_FALSE, &projectionMatrix[0][0]);
 
     glBindVertexArray(VertexArrayID);
     glDrawArrays(GL_TRIANGLES, 0, 6);
@@ -24,9 +24,8 @@ namespace MeowEngine::pipeline {
     public:
         void Render(
             const MeowEngine::OpenGLAssetManager& assetManager,
-            const MeowEngine::entity::RenderComponentBase* renderComponent,
-            const MeowEngine::entity::Transform3DComponent* transform3DComponent,
-            const MeowEngine::PerspectiveCamera* camera
+            const glm::mat4& viewMatrix,
+            const glm::mat4& projectionMatrix
         ) const;
 
     private:
@@ -0,0 +1,10 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "render_snapshot.hpp"
+
+void MeowEngine::RenderSnapshot::Clear() {
+    MeshInstances.clear();
+    GridInstances.clear();
+}
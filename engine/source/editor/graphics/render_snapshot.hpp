@@ -0,0 +1,41 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_RENDER_SNAPSHOT_HPP
+#define MEOWENGINE_RENDER_SNAPSHOT_HPP
+
+#include "glm_wrapper.hpp"
+#include "asset_inventory.hpp"
+#include "vector"
+#include "type_traits"
+
+namespace MeowEngine {
+    /**
+     * One draw, everything render needs without going back to the registry
+     */
+    struct RenderInstance {
+        glm::mat4 ModelMatrix;
+        MeowEngine::assets::ShaderPipelineType Pipeline;
+        MeowEngine::assets::StaticMeshType Mesh;
+        MeowEngine::assets::TextureType Texture;
+    };
+
+    static_assert(std::is_trivially_copyable_v<RenderInstance>, "RenderInstance is copied around as plain memory");
+
+    /**
+     * Packed draw list main thread extracts at sync time, render thread only reads this for the game view.
+     * Vectors keep their capacity between frames, so extraction doesn't allocate once the scene settled.
+     */
+    struct RenderSnapshot {
+        glm::mat4 ViewMatrix;
+        glm::mat4 ProjectionMatrix;
+
+        std::vector<RenderInstance> MeshInstances;
+        std::vector<RenderInstance> GridInstances;
+
+        void Clear();
+    };
+}
+
+#endif //MEOWENGINE_RENDER_SNAPSHOT_HPP
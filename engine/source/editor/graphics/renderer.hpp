@@ -9,13 +9,17 @@
 
 #include "entt_wrapper.hpp"
 #include "perspective_camera.hpp"
+#include "render_snapshot.hpp"
 #include "reflection_property_change.hpp"
-#include "queue"
+#include "property_change_queue.hpp"
 
 namespace MeowEngine {
     struct Renderer {
-        virtual void RenderGameView(MeowEngine::PerspectiveCamera* cameraObject, entt::registry& registry) = 0;
-        virtual void RenderUserInterface(entt::registry& registry, std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& inUIInputQueue, unsigned int frameBufferId, const double fps) = 0;
+        /**
+         * Draws game view from a snapshot extracted by main thread, doesn't touch any registry
+         */
+        virtual void RenderGameView(const MeowEngine::RenderSnapshot& inSnapshot) = 0;
+        virtual void RenderUserInterface(entt::registry& registry, MeowEngine::PropertyChangeQueue& inUIInputQueue, unsigned int frameBufferId, const double fps) = 0;
     };
 }
 
@@ -0,0 +1,20 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_INPUT_EVENT_HPP
+#define MEOWENGINE_INPUT_EVENT_HPP
+
+#include "sdl_wrapper.hpp"
+
+namespace MeowEngine::input {
+    /**
+     * SDL event stamped with performance counter when main thread polled it, used for input to present latency
+     */
+    struct InputEvent {
+        SDL_Event Event;
+        Uint64 Timestamp;
+    };
+}
+
+#endif //MEOWENGINE_INPUT_EVENT_HPP
@@ -0,0 +1,53 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "command_arena.hpp"
+#include "algorithm"
+#include "cstdint"
+
+MeowEngine::CommandArena::CommandArena(std::size_t inChunkSize)
+: ChunkSize(inChunkSize)
+, ChunkIndex(0) {}
+
+MeowEngine::CommandArena::~CommandArena() {
+    Reset();
+}
+
+void* MeowEngine::CommandArena::Allocate(std::size_t inSize, std::size_t inAlignment) {
+    while(ChunkIndex < Chunks.size()) {
+        Chunk& chunk = Chunks[ChunkIndex];
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(chunk.Data.get());
+        const std::size_t offset = ((base + chunk.Used + inAlignment - 1) & ~(inAlignment - 1)) - base;
+
+        if(offset + inSize <= chunk.Size) {
+            chunk.Used = offset + inSize;
+            return chunk.Data.get() + offset;
+        }
+
+        ChunkIndex++;
+    }
+
+    // big batches get a chunk of their own size, with room to align the start
+    const std::size_t size = std::max(ChunkSize, inSize + inAlignment);
+    Chunks.push_back({std::make_unique<std::byte[]>(size), size, 0});
+    ChunkIndex = Chunks.size() - 1;
+
+    return Allocate(inSize, inAlignment);
+}
+
+void MeowEngine::CommandArena::Reset() {
+    for(DestructorRecord& record : Destructors) {
+        record.Destroy(record.Value);
+    }
+    Destructors.clear();
+
+    for(Chunk& chunk : Chunks) {
+        chunk.Used = 0;
+    }
+    ChunkIndex = 0;
+}
+
+bool MeowEngine::CommandArena::IsEmpty() const {
+    return Chunks.empty() || (ChunkIndex == 0 && Chunks[0].Used == 0);
+}
@@ -0,0 +1,95 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_COMMAND_ARENA_HPP
+#define MEOWENGINE_COMMAND_ARENA_HPP
+
+#include "memory"
+#include "vector"
+#include "cstddef"
+#include "new"
+#include "type_traits"
+#include "utility"
+
+namespace MeowEngine {
+    /**
+     * Bump allocator for one frame of commands. Reset rewinds & keeps its chunks,
+     * so once a frame's worth of chunks exists recording doesn't allocate anymore.
+     */
+    class CommandArena {
+    public:
+        explicit CommandArena(std::size_t inChunkSize = 64 * 1024);
+
+        CommandArena(const CommandArena&) = delete;
+        CommandArena& operator=(const CommandArena&) = delete;
+
+        ~CommandArena();
+
+        void* Allocate(std::size_t inSize, std::size_t inAlignment);
+
+        /**
+         * Constructs a value in the arena, non trivial destructors run on Reset
+         */
+        template<typename Type, typename... Args>
+        Type* Create(Args&&... inArgs);
+
+        /**
+         * Copies a range into the arena & returns the first element
+         */
+        template<typename Type, typename Iterator>
+        Type* CreateRange(Iterator inFirst, std::size_t inCount);
+
+        /**
+         * Destroys everything created since last reset, chunks are kept for the next frame
+         */
+        void Reset();
+
+        bool IsEmpty() const;
+
+    private:
+        struct Chunk {
+            std::unique_ptr<std::byte[]> Data;
+            std::size_t Size;
+            std::size_t Used;
+        };
+
+        struct DestructorRecord {
+            void* Value;
+            void (*Destroy)(void*);
+        };
+
+        std::size_t ChunkSize;
+        std::vector<Chunk> Chunks;
+        std::size_t ChunkIndex;
+        std::vector<DestructorRecord> Destructors;
+    };
+
+    template<typename Type, typename... Args>
+    Type* CommandArena::Create(Args&&... inArgs) {
+        Type* value = new(Allocate(sizeof(Type), alignof(Type))) Type(std::forward<Args>(inArgs)...);
+
+        if constexpr (!std::is_trivially_destructible_v<Type>) {
+            Destructors.push_back({value, [](void* inValue) { static_cast<Type*>(inValue)->~Type(); }});
+        }
+
+        return value;
+    }
+
+    template<typename Type, typename Iterator>
+    Type* CommandArena::CreateRange(Iterator inFirst, std::size_t inCount) {
+        Type* values = static_cast<Type*>(Allocate(sizeof(Type) * inCount, alignof(Type)));
+
+        for(std::size_t i = 0; i < inCount; i++, ++inFirst) {
+            new(values + i) Type(*inFirst);
+
+            if constexpr (!std::is_trivially_destructible_v<Type>) {
+                Destructors.push_back({values + i, [](void* inValue) { static_cast<Type*>(inValue)->~Type(); }});
+            }
+        }
+
+        return values;
+    }
+}
+
+#endif //MEOWENGINE_COMMAND_ARENA_HPP
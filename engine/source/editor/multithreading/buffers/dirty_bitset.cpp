@@ -0,0 +1,56 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "dirty_bitset.hpp"
+#include "algorithm"
+
+MeowEngine::DirtyBitset::DirtyBitset()
+: Words(nullptr)
+, WordCount(0) {}
+
+void MeowEngine::DirtyBitset::Resize(std::size_t inCount) {
+    const std::size_t wordCount = (inCount + 63) / 64;
+
+    if(wordCount <= WordCount) {
+        return;
+    }
+
+    // grow by half again so entity by entity spawns don't reallocate every time
+    const std::size_t newWordCount = std::max(wordCount, WordCount + WordCount / 2);
+    std::unique_ptr<std::atomic<uint64_t>[]> words = std::make_unique<std::atomic<uint64_t>[]>(newWordCount);
+
+    for(std::size_t i = 0; i < newWordCount; i++) {
+        words[i].store(i < WordCount ? Words[i].load(std::memory_order_relaxed) : 0, std::memory_order_relaxed);
+    }
+
+    Words = std::move(words);
+    WordCount = newWordCount;
+}
+
+void MeowEngine::DirtyBitset::Mark(std::size_t inIndex) {
+    Resize(inIndex + 1);
+    Words[inIndex / 64].store(Words[inIndex / 64].load(std::memory_order_relaxed) | (uint64_t(1) << (inIndex % 64)), std::memory_order_relaxed);
+}
+
+void MeowEngine::DirtyBitset::MarkConcurrent(std::size_t inIndex) {
+    // job system wait orders these before the sync that reads them
+    Words[inIndex / 64].fetch_or(uint64_t(1) << (inIndex % 64), std::memory_order_relaxed);
+}
+
+std::size_t MeowEngine::DirtyBitset::GetCount() const {
+    std::size_t count = 0;
+
+    for(std::size_t i = 0; i < WordCount; i++) {
+        count += std::popcount(Words[i].load(std::memory_order_relaxed));
+    }
+
+    return count;
+}
+
+void MeowEngine::DirtyBitset::Clear() {
+    for(std::size_t i = 0; i < WordCount; i++) {
+        Words[i].store(0, std::memory_order_relaxed);
+    }
+}
+
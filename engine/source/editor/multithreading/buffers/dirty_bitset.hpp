@@ -0,0 +1,74 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_DIRTY_BITSET_HPP
+#define MEOWENGINE_DIRTY_BITSET_HPP
+
+#include "atomic"
+#include "memory"
+#include "cstdint"
+#include "cstddef"
+#include "bit"
+
+namespace MeowEngine {
+    /**
+     * One bit per entity index, set when a component of that entity changed.
+     * Walking it skips empty 64 entity words, so syncing mostly static scenes costs about a bit per entity.
+     */
+    class DirtyBitset {
+    public:
+        DirtyBitset();
+
+        DirtyBitset(DirtyBitset&& inOther) noexcept = default;
+        DirtyBitset& operator=(DirtyBitset&& inOther) noexcept = default;
+
+        /**
+         * Grows to fit inCount indices, keeps marked bits. Nobody may mark while resizing.
+         */
+        void Resize(std::size_t inCount);
+
+        /**
+         * Single writer, grows when index is out of range
+         */
+        void Mark(std::size_t inIndex);
+
+        /**
+         * Any number of writers, index has to be within the last Resize
+         */
+        void MarkConcurrent(std::size_t inIndex);
+
+        void Clear();
+
+        /**
+         * Number of marked indices, walks every word
+         */
+        std::size_t GetCount() const;
+
+        /**
+         * Calls inCallback(index) for every marked index in ascending order
+         */
+        template<typename Callback>
+        void ForEach(Callback&& inCallback) const;
+
+    private:
+        std::unique_ptr<std::atomic<uint64_t>[]> Words;
+        std::size_t WordCount;
+    };
+
+    template<typename Callback>
+    void DirtyBitset::ForEach(Callback&& inCallback) const {
+        for(std::size_t wordIndex = 0; wordIndex < WordCount; wordIndex++) {
+            uint64_t word = Words[wordIndex].load(std::memory_order_relaxed);
+
+            while(word != 0) {
+                const int bit = std::countr_zero(word);
+                word &= word - 1;
+
+                inCallback(wordIndex * 64 + bit);
+            }
+        }
+    }
+}
+
+#endif //MEOWENGINE_DIRTY_BITSET_HPP
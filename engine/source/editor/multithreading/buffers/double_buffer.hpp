@@ -7,6 +7,7 @@
 
 #include "utility"
 #include "tracy_wrapper.hpp"
+#include "frame_ring.hpp"
 
 using namespace std;
 
@@ -15,24 +16,34 @@ namespace MeowEngine {
     class DoubleBuffer {
 
     public:
-        DoubleBuffer() : Current{}, Final{} {}
+        DoubleBuffer() : Ring() {}
 
         T& GetCurrent() {
-            return Current;
+            return Ring.Get(CurrentStage);
         }
 
         T& GetFinal() {
-            return Final;
+            return Ring.Get(FinalStage);
+        }
+
+        uint64_t GetCurrentFrameIndex() const {
+            return Ring.GetFrameIndex(CurrentStage);
+        }
+
+        uint64_t GetFinalFrameIndex() const {
+            return Ring.GetFrameIndex(FinalStage);
         }
 
         void Swap() {
             PT_PROFILE_SCOPE;
-            std::swap(Current, Final);
+            Ring.Rotate();
         }
 
     protected:
-        T Current;
-        T Final;
+        static constexpr std::size_t CurrentStage = 0;
+        static constexpr std::size_t FinalStage = 1;
+
+        MeowEngine::FrameRing<T, 2> Ring;
     };
 }
 
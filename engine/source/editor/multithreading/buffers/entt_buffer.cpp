@@ -4,72 +4,260 @@
 
 #include "entt_buffer.hpp"
 #include "entt_reflection_wrapper.hpp"
+#include "algorithm"
 
 MeowEngine::EnttBuffer::EnttBuffer()
- : Staging() {}
+ : Staging()
+ , DeltaFrame(0)
+ , AckedResultStep(0)
+ , AppliedDeltaFrame(0)
+ , PublishedResultStep(0) {}
 
 entt::registry& MeowEngine::EnttBuffer::GetStaging() {
     return Staging;
 }
 
-std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& MeowEngine::EnttBuffer::GetPropertyChangeQueue() {
+MeowEngine::PropertyChangeQueue& MeowEngine::EnttBuffer::GetPropertyChangeQueue() {
     return UiInputPropertyChangesQueue;
 }
 
 entt::entity MeowEngine::EnttBuffer::AddEntity() {
-    entt::entity entity = Current.create();
-    Final.create(entity);
+    entt::entity entity = GetCurrent().create();
+    GetFinal().create(entity);
 
-    EntityToAddOnStagingQueue.enqueue(entity);
+    StagingCommands.RecordCreate(StagingCommands.CopyEntities({&entity, 1}));
+    ResizeCurrentChanges();
+    MarkChangedOnCurrent(entity);
 
     return entity;
 }
 
+std::vector<entt::entity> MeowEngine::EnttBuffer::CreateEntities(std::size_t inCount, std::span<const entt::entity>& outStagingEntities) {
+    std::vector<entt::entity> entities(inCount);
+
+    GetCurrent().storage<entt::entity>().reserve(GetCurrent().storage<entt::entity>().size() + inCount);
+    GetFinal().storage<entt::entity>().reserve(GetFinal().storage<entt::entity>().size() + inCount);
+
+    GetCurrent().create(entities.begin(), entities.end());
+    for(entt::entity entity : entities) {
+        GetFinal().create(entity);
+    }
+
+    // recorded in the same frame as single entities so staging creates ids in the same order
+    outStagingEntities = StagingCommands.CopyEntities(entities);
+    StagingCommands.RecordCreate(outStagingEntities);
+    ResizeCurrentChanges();
+
+    for(entt::entity entity : entities) {
+        MarkChangedOnCurrent(entity);
+    }
+
+    return entities;
+}
+
+void MeowEngine::EnttBuffer::ResizeCurrentChanges() {
+    const std::size_t entityCount = GetCurrent().storage<entt::entity>().size();
+
+    for(auto& [type, changes] : CurrentChanges) {
+        changes.Resize(entityCount);
+    }
+}
+
+void MeowEngine::EnttBuffer::MarkChangedOnCurrent(entt::entity inEntity) {
+    for(auto& [type, changes] : CurrentChanges) {
+        changes.Mark(entt::to_entity(inEntity));
+    }
+}
+
+void MeowEngine::EnttBuffer::AddRigidbodiesOnStaging(const std::vector<entt::entity>& inEntities, MeowEngine::simulator::Physics* inPhysics) {
+    auto view = Staging.view<entity::Transform3DComponent, entity::ColliderComponent, entity::RigidbodyComponent>();
+
+    std::vector<MeowEngine::simulator::RigidbodyBinding> bindings;
+    bindings.reserve(inEntities.size());
+
+    for(entt::entity entity : inEntities) {
+        if(view.contains(entity)) {
+            auto [transform, collider, rigidbody] = view.get<entity::Transform3DComponent, entity::ColliderComponent, entity::RigidbodyComponent>(entity);
+
+            if(rigidbody.GetPhysicsBody() == nullptr) {
+                bindings.push_back({&transform, &collider, &rigidbody, entity});
+            }
+        }
+    }
+
+    inPhysics->AddRigidbodies(bindings);
+}
+
+void MeowEngine::EnttBuffer::ReleaseRigidbodiesOnStaging(const StagingCommand& inCommand, MeowEngine::simulator::Physics* inPhysics) {
+    if(inCommand.Kind == StagingCommandKind::RemoveComponents && !MeowEngine::IsPhysicsComponent(inCommand.ComponentType)) {
+        return;
+    }
+
+    auto& rigidbodyStorage = Staging.storage<entity::RigidbodyComponent>();
+
+    StagingReleasedRigidbodies.clear();
+    for(uint32_t i = 0; i < inCommand.EntityCount; i++) {
+        // contains checks version as well, stale ids don't release a recycled entity's body
+        if(rigidbodyStorage.contains(inCommand.Entities[i])) {
+            StagingReleasedRigidbodies.push_back(&rigidbodyStorage.get(inCommand.Entities[i]));
+        }
+    }
+
+    if(!StagingReleasedRigidbodies.empty()) {
+        inPhysics->RemoveRigidbodies(StagingReleasedRigidbodies);
+    }
+}
+
 void MeowEngine::EnttBuffer::ApplyAddRemoveOnStaging(MeowEngine::simulator::Physics* inPhysics) {
-    AddEntitiesOnStaging();
-    AddComponentsOnStaging(inPhysics);
+    // Applies entities & components recorded on main thread, entities that got a physics component are bound together after
+    StagingRigidbodyEntities.clear();
+
+    StagingCommands.Apply(Staging,
+        [&](const StagingCommand& inCommand) {
+            ReleaseRigidbodiesOnStaging(inCommand, inPhysics);
+        },
+        [&](const StagingCommand& inCommand) {
+            if(MeowEngine::IsPhysicsComponent(inCommand.ComponentType)) {
+                StagingRigidbodyEntities.insert(StagingRigidbodyEntities.end(), inCommand.Entities, inCommand.Entities + inCommand.EntityCount);
+            }
+        }
+    );
+
+    if(StagingRigidbodyEntities.empty()) {
+        return;
+    }
+
+    // an entity shows up once per physics component it got, ids destroyed later in the frame fail the view check
+    std::sort(StagingRigidbodyEntities.begin(), StagingRigidbodyEntities.end());
+    StagingRigidbodyEntities.erase(std::unique(StagingRigidbodyEntities.begin(), StagingRigidbodyEntities.end()), StagingRigidbodyEntities.end());
+
+    AddRigidbodiesOnStaging(StagingRigidbodyEntities, inPhysics);
+}
+
+void MeowEngine::EnttBuffer::RemoveEntity(entt::entity inEntity) {
+    EntitiesToRemove.push_back(inEntity);
+}
+
+void MeowEngine::EnttBuffer::RemoveEntities(std::span<const entt::entity> inEntities) {
+    EntitiesToRemove.insert(EntitiesToRemove.end(), inEntities.begin(), inEntities.end());
 }
 
-void MeowEngine::EnttBuffer::AddEntitiesOnStaging() {
-    // If we have anything to dequeue from concurrent queue, we replicate and add in staging buffer
-    entt::entity entity;
-    while(EntityToAddOnStagingQueue.try_dequeue(entity)) {
-        Staging.create(entity);
+const std::vector<entt::entity>& MeowEngine::EnttBuffer::GetRemovedEntities() const {
+    return RemovedEntities;
+}
+
+void MeowEngine::EnttBuffer::ApplyRemovals() {
+    RemovedEntities.clear();
+
+    for(const PendingComponentRemoval& removal : ComponentsToRemove) {
+        auto* currentStorage = GetCurrent().storage(removal.ComponentType);
+        auto* finalStorage = GetFinal().storage(removal.ComponentType);
+
+        // remove checks version, stale ids are a no-op
+        if(currentStorage == nullptr || !currentStorage->remove(removal.Entity)) {
+            continue;
+        }
+
+        if(finalStorage != nullptr) {
+            finalStorage->remove(removal.Entity);
+        }
+
+        MarkChangedOnCurrent(removal.Entity);
+
+        if(removal.RecordOnStaging != nullptr) {
+            removal.RecordOnStaging(StagingCommands, removal.Entity);
+        }
+    }
+    ComponentsToRemove.clear();
+
+    if(EntitiesToRemove.empty()) {
+        return;
+    }
+
+    // drop duplicates & ids that were already destroyed or recycled
+    std::sort(EntitiesToRemove.begin(), EntitiesToRemove.end());
+    EntitiesToRemove.erase(std::unique(EntitiesToRemove.begin(), EntitiesToRemove.end()), EntitiesToRemove.end());
+
+    for(entt::entity entity : EntitiesToRemove) {
+        if(GetCurrent().valid(entity)) {
+            RemovedEntities.push_back(entity);
+        }
     }
+    EntitiesToRemove.clear();
+
+    if(RemovedEntities.empty()) {
+        return;
+    }
+
+    // both registries release in the same order, so they keep handing out the same ids
+    GetCurrent().destroy(RemovedEntities.begin(), RemovedEntities.end());
+    GetFinal().destroy(RemovedEntities.begin(), RemovedEntities.end());
+
+    StagingCommands.RecordDestroy(StagingCommands.CopyEntities(RemovedEntities));
 }
 
-void MeowEngine::EnttBuffer::AddComponentsOnStaging(MeowEngine::simulator::Physics* inPhysics) {
-    // Adds components with dynamic data parameter passed down from main thread
-    std::function<void(MeowEngine::simulator::Physics*)> method;
-    while(ComponentToAddOnStagingQueue.try_dequeue(method)) {
-        method(inPhysics);
+void MeowEngine::EnttBuffer::ApplyDeltasOnStaging() {
+    const StagingDeltaBlock* deltas = DeltaMailbox.Read();
+    if(deltas == nullptr) {
+        return;
+    }
+
+    // blocks repeat deltas until acknowledged, frames already applied are skipped
+    for(const StagingDelta& delta : deltas->Deltas) {
+        if(delta.Frame > AppliedDeltaFrame) {
+            delta.Apply(Staging, delta.Entity, delta.Value);
+        }
+    }
+    AppliedDeltaFrame = std::max(AppliedDeltaFrame, deltas->LastFrame);
+
+    // main has everything published so far, next results only need what moves from now on
+    if(deltas->AckedResultStep == PublishedResultStep) {
+        for(auto& [type, changes] : StagingChanges) {
+            changes.Clear();
+        }
     }
 }
 
 void MeowEngine::EnttBuffer::ApplyPropertyChange() {
     // Apply changes on current and final buffer and push into queue for same changes for staging
-    while(!UiInputPropertyChangesQueue.empty()) {
-        std::shared_ptr<MeowEngine::ReflectionPropertyChange> change = UiInputPropertyChangesQueue.front();
+    // only the latest change per entity / component / property reaches here
+    UiInputPropertyChangesQueue.Drain([&](MeowEngine::PropertyChangePtr& inChange) {
+        // ui may have edited an entity or component removed since it drew, contains checks the entity version too
+        const auto* componentStorage = std::as_const(GetCurrent()).storage(inChange->ComponentType);
+        if(componentStorage == nullptr || !componentStorage->contains(static_cast<entt::entity>(inChange->EntityId))) {
+            return;
+        }
 
-        MeowEngine::Reflection.ApplyPropertyChange(*change.get(), Current);
-        MeowEngine::Reflection.ApplyPropertyChange(*change.get(), Final);
+        MeowEngine::Reflection.ApplyPropertyChange(*inChange, GetCurrent());
+        MeowEngine::Reflection.ApplyPropertyChange(*inChange, GetFinal());
+        MarkChangedOnCurrent(static_cast<entt::entity>(inChange->EntityId));
 
-        PhysicsUiInputPropertyChangesQueue.enqueue(change);
-        UiInputPropertyChangesQueue.pop();
-    }
+        PhysicsUiInputPropertyChangesQueue.enqueue(std::move(inChange));
+    });
 }
 
 void MeowEngine::EnttBuffer::ApplyPropertyChangeOnStaging() {
     // Apply update physics transform to entities
     auto view = Staging.view<entity::Transform3DComponent, entity::RigidbodyComponent>();
 
+    // physics may have missed a few main syncs, changes of those frames are coalesced again
+    MeowEngine::PropertyChangePtr queuedChange;
+    while(PhysicsUiInputPropertyChangesQueue.try_dequeue(queuedChange)) {
+        StagingPropertyChangesQueue.Push(std::move(queuedChange));
+    }
+
     // Apply UI inputs to physics components
-    std::shared_ptr<MeowEngine::ReflectionPropertyChange> change;
-    while(PhysicsUiInputPropertyChangesQueue.try_dequeue(change)) {
+    StagingPropertyChangesQueue.Drain([&](MeowEngine::PropertyChangePtr& change) {
+        // staging only keeps physics components, edits of anything else are main & render only
+        const auto* componentStorage = std::as_const(Staging).storage(change->ComponentType);
+        if(componentStorage == nullptr || !componentStorage->contains(static_cast<entt::entity>(change->EntityId))) {
+            return;
+        }
+
         if(view.contains(static_cast<entt::entity>(change->EntityId))) {
             MeowEngine::Reflection.ApplyPropertyChange(*change, Staging);
             auto [transform, rigidbody] = view.get<entity::Transform3DComponent, entity::RigidbodyComponent>(static_cast<entt::entity>(change->EntityId));
             rigidbody.OverrideTransform(transform);
         }
-    }
+    });
 }
\ No newline at end of file
@@ -7,8 +7,19 @@
 
 #include "entt_wrapper.hpp"
 #include "double_buffer.hpp"
-#include "queue"
-#include "functional"
+#include "dirty_bitset.hpp"
+#include "sync_traits.hpp"
+#include "component_sync_traits.hpp"
+#include "staging_command_buffer.hpp"
+#include "staging_sync_blocks.hpp"
+#include "mailbox.hpp"
+#include "property_change_queue.hpp"
+#include "vector"
+#include "span"
+#include "unordered_map"
+#include "algorithm"
+#include "cstring"
+#include "type_traits"
 #include "concurrentqueue.h"
 
 #include <transform3d_component.hpp>
@@ -20,12 +31,35 @@
 using namespace std;
 
 namespace MeowEngine {
+    /**
+     * Steps of the scene sync functions, in the order a scene frame runs them
+     */
+    enum class EnttSyncStage {
+        SyncWithStaging,
+        ApplyDeltasOnStaging,
+        ApplyPropertyChangeOnStaging,
+        PublishToCurrent,
+        SyncWithFinal,
+        ApplyPropertyChange,
+        ApplyRemovals
+    };
+
+    /**
+     * Default sync observer, runs the step as is. Benchmarks pass one that times every step.
+     */
+    struct RunSyncStage {
+        template<typename Step>
+        void operator()(EnttSyncStage inStage, Step&& inStep) const {
+            inStep();
+        }
+    };
+
     struct EnttBuffer : public DoubleBuffer<entt::registry> {
     public:
         EnttBuffer();
 
         entt::registry& GetStaging();
-        std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& GetPropertyChangeQueue();
+        MeowEngine::PropertyChangeQueue& GetPropertyChangeQueue();
 
         entt::entity AddEntity();
 
@@ -35,6 +69,135 @@ namespace MeowEngine {
         template<typename ComponentType, typename... Args>
         void AddComponent(const entt::entity& inEntity, Args &&...inArgs);
 
+        /**
+         * Spawns inCount entities that all start as copies of the archetype components.
+         * Storage is reserved once per registry, staging gets one command per component for the whole batch
+         * & physics bodies of the batch are inserted together.
+         */
+        template<typename... ComponentTypes>
+        std::vector<entt::entity> AddEntities(std::size_t inCount, const ComponentTypes&... inArchetype);
+
+        /**
+         * Spawns one entity per initial value, every entity also gets a copy of the shared archetype components.
+         * i.e. AddEntities<Transform3DComponent>(transforms, life, mesh, collider, rigidbody)
+         */
+        template<typename VaryingType, typename... ComponentTypes>
+        std::vector<entt::entity> AddEntities(std::span<const VaryingType> inValues, const ComponentTypes&... inArchetype);
+
+        /**
+         * Gives existing entities one component each, i.e. a loaded scene filling entities block by block.
+         * Same storage reserve & single staging command as AddEntities.
+         */
+        template<typename ComponentType>
+        void AddComponents(std::span<const entt::entity> inEntities, std::span<const ComponentType> inValues);
+
+        /**
+         * Main thread only. Entity is destroyed on every registry at next render sync (ApplyRemovals),
+         * its physics body is released on physics thread after. Stale ids are ignored.
+         */
+        void RemoveEntity(entt::entity inEntity);
+
+        /**
+         * Batch of RemoveEntity, staging gets one command for the whole batch
+         */
+        void RemoveEntities(std::span<const entt::entity> inEntities);
+
+        /**
+         * Main thread only. Component is removed on every registry at next render sync, removing a physics component
+         * releases the entity's body.
+         */
+        template<typename ComponentType>
+        void RemoveComponent(entt::entity inEntity);
+
+        /**
+         * Applies queued removals to current(main) & final(render) & queues them for staging(physics).
+         * Render thread can't be reading final while this runs.
+         */
+        void ApplyRemovals();
+
+        /**
+         * Entities destroyed by the last ApplyRemovals
+         */
+        const std::vector<entt::entity>& GetRemovedEntities() const;
+
+        /**
+         * Starts change tracking for a component type, call before any thread marks changes
+         */
+        template<typename ComponentType>
+        void TrackChanges();
+
+        /**
+         * Entities whose component changed on current(main) since last render sync.
+         * Updates mark it, physics & render syncs only visit marked entities.
+         */
+        template<typename ComponentType>
+        DirtyBitset& GetCurrentChanges();
+
+        /**
+         * Entities whose component was moved by physics on staging since the last result step main acknowledged
+         */
+        template<typename ComponentType>
+        DirtyBitset& GetStagingChanges();
+
+        /**
+         * Main thread, generated from SyncTraits. DeltaMerge fields changed on current(main) are mailed to staging(physics)
+         * as deltas & the newest physics results are pulled into current. Never waits on physics.
+         */
+        template<typename... ComponentTypes>
+        void SyncWithStaging();
+
+        /**
+         * Physics thread. Applies main's deltas from the newest delta block, has to run before physics publishes results.
+         */
+        void ApplyDeltasOnStaging();
+
+        /**
+         * Physics thread, generated from SyncTraits. Publishes OwnerWins & DeltaMerge fields of every entity physics
+         * moved since main's last acknowledged step.
+         */
+        template<typename... ComponentTypes>
+        void PublishToCurrent();
+
+        /**
+         * Generated from SyncTraits. Every synced field changed on current(main) is copied to final(render).
+         * Changes are cleared after, as both buffers match once swapped.
+         */
+        template<typename... ComponentTypes>
+        void SyncWithFinal();
+
+        /**
+         * Main thread, physics side of a scene's buffer sync. Deltas & results are exchanged with staging(physics),
+         * then adds & removes recorded this frame are handed over.
+         * Scenes & benchmarks both sync through these, so stage order can't differ between them.
+         * @param inObserver called as inObserver(EnttSyncStage, step), has to run the step
+         */
+        template<typename... ComponentTypes, typename Observer = RunSyncStage>
+        void SyncPhysicsOnMain(Observer&& inObserver = {});
+
+        /**
+         * Physics thread, after stepping. inMoveBodies copies moved bodies onto staging & marks staging changes,
+         * it runs after main's deltas are applied & before ui edits & results.
+         */
+        template<typename... ComponentTypes, typename MoveBodies, typename Observer = RunSyncStage>
+        void SyncPhysicsOnStaging(MoveBodies&& inMoveBodies, Observer&& inObserver = {});
+
+        /**
+         * Main thread while render waits, synced fields go to final(render), then ui edits & removals are applied
+         */
+        template<typename... ComponentTypes, typename Observer = RunSyncStage>
+        void SyncRenderOnMain(Observer&& inObserver = {});
+
+        /**
+         * Calls inCallback(entity) for every live entity marked in inChanges
+         */
+        template<typename Callback>
+        static void ForEachChanged(const entt::registry& inRegistry, const DirtyBitset& inChanges, Callback&& inCallback);
+
+        /**
+         * Hands components recorded for staging(physics) this frame over, called once per main frame
+         */
+        void SubmitStagingCommands();
+
         /**
          * Add / Remove entities & components on staging buffer which are queued from main thread
          * @param inPhysics
@@ -54,76 +217,512 @@ namespace MeowEngine {
 
     protected:
         /**
-         * Add / Remove entities from staging (physics) buffer
+         * Creates a batch of entities on current(main) & final(render), same ids are queued for staging(physics)
+         * @param outStagingEntities copy of the ids owned by the staging command frame, for the batch's components
          */
-        void AddEntitiesOnStaging();
+        std::vector<entt::entity> CreateEntities(std::size_t inCount, std::span<const entt::entity>& outStagingEntities);
 
         /**
-         * Add / Remove components from staging (physics) buffer
-         * @param inPhysics
+         * Hands every batch entity with transform, collider & rigidbody to physics in one call
+         */
+        void AddRigidbodiesOnStaging(const std::vector<entt::entity>& inEntities, MeowEngine::simulator::Physics* inPhysics);
+
+        /**
+         * Releases bodies of entities a removal command is about to destroy or strip of a physics component
+         */
+        void ReleaseRigidbodiesOnStaging(const StagingCommand& inCommand, MeowEngine::simulator::Physics* inPhysics);
+
+        template<typename... ComponentTypes>
+        static void ReserveComponents(entt::registry& inRegistry, std::size_t inCount);
+
+        /**
+         * Records a batch copy of inValue for staging, skipped for components physics doesn't keep (see StagingTraits)
+         */
+        template<typename ComponentType>
+        void RecordOnStaging(std::span<const entt::entity> inEntities, const ComponentType& inValue);
+
+        template<typename ComponentType>
+        void RecordDeltasForStaging();
+
+        template<typename ComponentType>
+        void PullResultsFromStaging(const StagingResultBlock& inResults);
+
+        template<typename ComponentType>
+        void WriteResultsForCurrent(StagingResultBlock& outResults);
+
+        /**
+         * Adds a mailed delta to its staging target, one instance per DeltaMerge field
          */
-        void AddComponentsOnStaging(MeowEngine::simulator::Physics* inPhysics);
+        template<typename DeltaTargetType, typename FieldType>
+        static void ApplyDelta(entt::registry& inRegistry, entt::entity inEntity, const void* inValue);
+
+        template<typename ComponentType>
+        void SyncChangesToFinal();
+
+        /**
+         * Makes room for new entities so update workers can mark them concurrently
+         */
+        void ResizeCurrentChanges();
+
+        /**
+         * New entities & ui edits count as changed for every tracked component, so syncs & render extraction pick them up
+         */
+        void MarkChangedOnCurrent(entt::entity inEntity);
+
+        /**
+         * Change bits per component type, keyed by entt type hash. Sets are created up front with TrackChanges,
+         * so threads only look them up.
+         */
+        std::unordered_map<entt::id_type, DirtyBitset> CurrentChanges;
+        std::unordered_map<entt::id_type, DirtyBitset> StagingChanges;
+
+        /**
+         * Main -> physics deltas & physics -> main results, each side only does one atomic exchange per sync
+         */
+        Mailbox<StagingDeltaBlock> DeltaMailbox;
+        Mailbox<StagingResultBlock> ResultMailbox;
+
+        /**
+         * Main thread only. Deltas physics hasn't acknowledged yet, in recording order.
+         */
+        std::vector<StagingDelta> PendingDeltas;
+        uint64_t DeltaFrame;
+        uint64_t AckedResultStep;
+
+        /**
+         * Physics thread only
+         */
+        uint64_t AppliedDeltaFrame;
+        uint64_t PublishedResultStep;
 
         entt::registry Staging;
 
         /**
          * When a property value is changed on Render (ui) we queue in this list
          */
-        std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>> UiInputPropertyChangesQueue;
+        MeowEngine::PropertyChangeQueue UiInputPropertyChangesQueue;
 
     private:
         /**
-         * When a entity is added on main thread, we queue it and add it async on physics thread
+         * Component removal waiting for render sync, staging removal is recorded through RecordOnStaging
+         * which is null for components physics doesn't keep
          */
-        moodycamel::ConcurrentQueue<entt::entity> EntityToAddOnStagingQueue;
+        struct PendingComponentRemoval {
+            entt::entity Entity;
+            entt::id_type ComponentType;
+            void (*RecordOnStaging)(StagingCommandBuffer&, entt::entity);
+        };
 
         /**
-         * When a component is added from main thread, we queue it as a method with args
-         * and add it async on physics thread
+         * Main thread only, removals requested since last render sync
          */
-        moodycamel::ConcurrentQueue<std::function<void(MeowEngine::simulator::Physics*)>> ComponentToAddOnStagingQueue;
+        std::vector<entt::entity> EntitiesToRemove;
+        std::vector<PendingComponentRemoval> ComponentsToRemove;
+        std::vector<entt::entity> RemovedEntities;
+
+        /**
+         * When a entity or component is added / removed on main thread, we record it
+         * and apply it async on physics thread
+         */
+        StagingCommandBuffer StagingCommands;
+
+        /**
+         * Physics thread only, entities that got a physics component / bodies to release this frame.
+         * Kept to reuse their capacity.
+         */
+        std::vector<entt::entity> StagingRigidbodyEntities;
+        std::vector<entity::RigidbodyComponent*> StagingReleasedRigidbodies;
 
         /**
          * Any queued property value changes are applied to staging(physics) buffer
          */
-        moodycamel::ConcurrentQueue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>> PhysicsUiInputPropertyChangesQueue;
+        moodycamel::ConcurrentQueue<MeowEngine::PropertyChangePtr> PhysicsUiInputPropertyChangesQueue;
+
+        /**
+         * Physics thread only, changes of every main sync physics missed coalesced together
+         */
+        MeowEngine::PropertyChangeQueue StagingPropertyChangesQueue;
     };
 
     template<typename Type, typename... Args>
     void MeowEngine::EnttBuffer::AddComponent(entt::entity &inEntity, Args &&... inArgs) {
-        Current.emplace<Type>(inEntity, std::forward<Args>(inArgs)...);
-        Final.emplace<Type>(inEntity, std::forward<Args>(inArgs)...);
+        GetCurrent().emplace<Type>(inEntity, std::forward<Args>(inArgs)...);
+        GetFinal().emplace<Type>(inEntity, std::forward<Args>(inArgs)...);
 
-        ComponentToAddOnStagingQueue.enqueue([&, inEntity, inArgTuple = std::make_tuple(std::forward<Args>(inArgs)...)](MeowEngine::simulator::Physics* inPhysics) {
-            std::apply([&](auto&&... inUnpacked) {
+        if constexpr (StagingTraits<Type>::IsStaged) {
+            StagingCommands.Record<Type>(inEntity, std::as_const(GetCurrent()).get<Type>(inEntity));
+        }
+    }
 
-                Staging.emplace<Type>(inEntity, std::forward<decltype(inUnpacked)>(inUnpacked)...);
-            }, inArgTuple);
+    template<typename Type, typename... Args>
+    void MeowEngine::EnttBuffer::AddComponent(const entt::entity &inEntity, Args &&... inArgs) {
+        GetCurrent().emplace<Type>(inEntity, std::forward<Args>(inArgs)...);
+        GetFinal().emplace<Type>(inEntity, std::forward<Args>(inArgs)...);
 
-            if(Staging.all_of<entity::Transform3DComponent, entity::ColliderComponent, entity::RigidbodyComponent>(inEntity)) {
-                auto [transform, collider, rigidbody] =  Staging.get<entity::Transform3DComponent, entity::ColliderComponent, entity::RigidbodyComponent>(inEntity);
-                inPhysics->AddRigidbody(transform, collider, rigidbody);
-            }
+        if constexpr (StagingTraits<Type>::IsStaged) {
+            StagingCommands.Record<Type>(inEntity, std::as_const(GetCurrent()).get<Type>(inEntity));
+        }
+    }
+
+    template<typename... ComponentTypes>
+    std::vector<entt::entity> MeowEngine::EnttBuffer::AddEntities(std::size_t inCount, const ComponentTypes&... inArchetype) {
+        std::span<const entt::entity> stagingEntities;
+        std::vector<entt::entity> entities = CreateEntities(inCount, stagingEntities);
+
+        ReserveComponents<ComponentTypes...>(GetCurrent(), inCount);
+        ReserveComponents<ComponentTypes...>(GetFinal(), inCount);
+
+        (GetCurrent().insert<ComponentTypes>(entities.begin(), entities.end(), inArchetype), ...);
+        (GetFinal().insert<ComponentTypes>(entities.begin(), entities.end(), inArchetype), ...);
+
+        (RecordOnStaging(stagingEntities, inArchetype), ...);
+
+        return entities;
+    }
+
+    template<typename VaryingType, typename... ComponentTypes>
+    std::vector<entt::entity> MeowEngine::EnttBuffer::AddEntities(std::span<const VaryingType> inValues, const ComponentTypes&... inArchetype) {
+        std::span<const entt::entity> stagingEntities;
+        std::vector<entt::entity> entities = CreateEntities(inValues.size(), stagingEntities);
+
+        ReserveComponents<VaryingType, ComponentTypes...>(GetCurrent(), inValues.size());
+        ReserveComponents<VaryingType, ComponentTypes...>(GetFinal(), inValues.size());
+
+        GetCurrent().insert<VaryingType>(entities.begin(), entities.end(), inValues.begin());
+        GetFinal().insert<VaryingType>(entities.begin(), entities.end(), inValues.begin());
+        (GetCurrent().insert<ComponentTypes>(entities.begin(), entities.end(), inArchetype), ...);
+        (GetFinal().insert<ComponentTypes>(entities.begin(), entities.end(), inArchetype), ...);
+
+        // values physics never reads aren't copied for it
+        if constexpr (StagingTraits<VaryingType>::IsStaged) {
+            StagingCommands.RecordEach<VaryingType>(stagingEntities, inValues);
+        }
+        (RecordOnStaging(stagingEntities, inArchetype), ...);
+
+        return entities;
+    }
+
+    template<typename ComponentType>
+    void MeowEngine::EnttBuffer::AddComponents(std::span<const entt::entity> inEntities, std::span<const ComponentType> inValues) {
+        ReserveComponents<ComponentType>(GetCurrent(), inEntities.size());
+        ReserveComponents<ComponentType>(GetFinal(), inEntities.size());
+
+        GetCurrent().insert<ComponentType>(inEntities.begin(), inEntities.end(), inValues.begin());
+        GetFinal().insert<ComponentType>(inEntities.begin(), inEntities.end(), inValues.begin());
+
+        if constexpr (StagingTraits<ComponentType>::IsStaged) {
+            StagingCommands.RecordEach<ComponentType>(StagingCommands.CopyEntities(inEntities), inValues);
+        }
+
+        for(entt::entity entity : inEntities) {
+            MarkChangedOnCurrent(entity);
+        }
+    }
+
+    template<typename ComponentType>
+    void MeowEngine::EnttBuffer::RecordOnStaging(std::span<const entt::entity> inEntities, const ComponentType& inValue) {
+        if constexpr (StagingTraits<ComponentType>::IsStaged) {
+            StagingCommands.RecordShared<ComponentType>(inEntities, inValue);
+        }
+    }
+
+    template<typename ComponentType>
+    void MeowEngine::EnttBuffer::RemoveComponent(entt::entity inEntity) {
+        void (*recordOnStaging)(StagingCommandBuffer&, entt::entity) = nullptr;
+
+        if constexpr (StagingTraits<ComponentType>::IsStaged) {
+            recordOnStaging = [](StagingCommandBuffer& inCommands, entt::entity inStagingEntity) {
+                inCommands.RecordRemove<ComponentType>(inStagingEntity);
+            };
+        }
+
+        ComponentsToRemove.push_back({inEntity, entt::type_hash<ComponentType>::value(), recordOnStaging});
+    }
+
+    template<typename ComponentType>
+    void MeowEngine::EnttBuffer::TrackChanges() {
+        CurrentChanges.try_emplace(entt::type_hash<ComponentType>::value());
+        StagingChanges.try_emplace(entt::type_hash<ComponentType>::value());
+        ResizeCurrentChanges();
+    }
+
+    template<typename... ComponentTypes>
+    void MeowEngine::EnttBuffer::SyncWithStaging() {
+        // deltas are current - final, so they're taken before results move current
+        DeltaFrame++;
+        (RecordDeltasForStaging<ComponentTypes>(), ...);
+
+        if(const StagingResultBlock* results = ResultMailbox.Read()) {
+            // whatever physics applied doesn't need to be mailed again
+            auto applied = std::find_if(PendingDeltas.begin(), PendingDeltas.end(), [&](const StagingDelta& inDelta) {
+                return inDelta.Frame > results->AppliedDeltaFrame;
+            });
+            PendingDeltas.erase(PendingDeltas.begin(), applied);
+
+            (PullResultsFromStaging<ComponentTypes>(*results), ...);
+            AckedResultStep = results->Step;
+        }
+
+        StagingDeltaBlock& deltas = DeltaMailbox.GetWrite();
+        deltas.LastFrame = DeltaFrame;
+        deltas.AckedResultStep = AckedResultStep;
+        deltas.Deltas.assign(PendingDeltas.begin(), PendingDeltas.end());
+        DeltaMailbox.Publish();
+    }
+
+    template<typename... ComponentTypes>
+    void MeowEngine::EnttBuffer::PublishToCurrent() {
+        StagingResultBlock& results = ResultMailbox.GetWrite();
+        results.Step = ++PublishedResultStep;
+        results.AppliedDeltaFrame = AppliedDeltaFrame;
+
+        (WriteResultsForCurrent<ComponentTypes>(results), ...);
+        ResultMailbox.Publish();
+    }
+
+    template<typename... ComponentTypes>
+    void MeowEngine::EnttBuffer::SyncWithFinal() {
+        (SyncChangesToFinal<ComponentTypes>(), ...);
+    }
+
+    template<typename... ComponentTypes, typename Observer>
+    void MeowEngine::EnttBuffer::SyncPhysicsOnMain(Observer&& inObserver) {
+        inObserver(EnttSyncStage::SyncWithStaging, [this] {
+            // field ownership comes from SyncTraits, see component_sync_traits.hpp
+            SyncWithStaging<ComponentTypes...>();
+
+            // components added this frame reach physics on its next add / remove step
+            SubmitStagingCommands();
         });
+    }
 
+    template<typename... ComponentTypes, typename MoveBodies, typename Observer>
+    void MeowEngine::EnttBuffer::SyncPhysicsOnStaging(MoveBodies&& inMoveBodies, Observer&& inObserver) {
+        // main's deltas move awake bodies before they are read, sleeping ones wake up & show up next frame
+        inObserver(EnttSyncStage::ApplyDeltasOnStaging, [this] {
+            ApplyDeltasOnStaging();
+        });
+
+        inMoveBodies();
+
+        inObserver(EnttSyncStage::ApplyPropertyChangeOnStaging, [this] {
+            ApplyPropertyChangeOnStaging();
+        });
+
+        inObserver(EnttSyncStage::PublishToCurrent, [this] {
+            PublishToCurrent<ComponentTypes...>();
+        });
     }
 
-    template<typename Type, typename... Args>
-    void MeowEngine::EnttBuffer::AddComponent(const entt::entity &inEntity, Args &&... inArgs) {
-        Current.emplace<Type>(inEntity, std::forward<Args>(inArgs)...);
-        Final.emplace<Type>(inEntity, std::forward<Args>(inArgs)...);
+    template<typename... ComponentTypes, typename Observer>
+    void MeowEngine::EnttBuffer::SyncRenderOnMain(Observer&& inObserver) {
+        inObserver(EnttSyncStage::SyncWithFinal, [this] {
+            SyncWithFinal<ComponentTypes...>();
+        });
+
+        // ui edits go to current & final, physics gets them queued
+        inObserver(EnttSyncStage::ApplyPropertyChange, [this] {
+            ApplyPropertyChange();
+        });
+
+        // render is waiting, so final can lose entities here
+        inObserver(EnttSyncStage::ApplyRemovals, [this] {
+            ApplyRemovals();
+        });
+    }
+
+    template<typename ComponentType>
+    void MeowEngine::EnttBuffer::RecordDeltasForStaging() {
+        if constexpr (HasSyncPolicy<ComponentType, SyncPolicy::DeltaMerge>()) {
+            auto& currentStorage = GetCurrent().storage<ComponentType>();
+            auto& finalStorage = GetFinal().storage<ComponentType>();
+
+            // final still holds the value of last sync, so the difference is main's own change
+            ForEachChanged(GetCurrent(), GetCurrentChanges<ComponentType>(), [&](entt::entity inEntity) {
+                if(!currentStorage.contains(inEntity) || !finalStorage.contains(inEntity)) {
+                    return;
+                }
+
+                const ComponentType& current = currentStorage.get(inEntity);
+                const ComponentType& final = finalStorage.get(inEntity);
+
+                ForEachSyncField<ComponentType>([&](auto inField) {
+                    using Field = decltype(inField);
+
+                    if constexpr (Field::FieldPolicy == SyncPolicy::DeltaMerge) {
+                        using FieldType = std::decay_t<decltype(std::declval<ComponentType&>().*Field::Member)>;
+                        static_assert(std::is_trivially_copyable_v<FieldType> && sizeof(FieldType) <= sizeof(StagingDelta::Value),
+                                      "DeltaMerge fields are mailed as plain bytes");
+
+                        const FieldType delta = current.*Field::Member - final.*Field::Member;
+                        if(delta == FieldType{}) {
+                            return;
+                        }
+
+                        StagingDelta& staged = PendingDeltas.emplace_back();
+                        staged.Entity = inEntity;
+                        staged.Frame = DeltaFrame;
+                        staged.Apply = &ApplyDelta<typename Field::DeltaTarget, FieldType>;
+                        std::memcpy(staged.Value, &delta, sizeof(FieldType));
+                    }
+                });
+            });
+        }
+    }
+
+    template<typename DeltaTargetType, typename FieldType>
+    void MeowEngine::EnttBuffer::ApplyDelta(entt::registry& inRegistry, entt::entity inEntity, const void* inValue) {
+        auto& targetStorage = inRegistry.storage<DeltaTargetType>();
+
+        // version checked, deltas of a destroyed entity don't reach a recycled one
+        if(!targetStorage.contains(inEntity)) {
+            return;
+        }
+
+        FieldType delta;
+        std::memcpy(&delta, inValue, sizeof(FieldType));
+        targetStorage.get(inEntity).AddDelta(delta);
+    }
+
+    template<typename ComponentType>
+    void MeowEngine::EnttBuffer::WriteResultsForCurrent(StagingResultBlock& outResults) {
+        if constexpr (HasSyncPolicy<ComponentType, SyncPolicy::DeltaMerge>() || HasSyncPolicy<ComponentType, SyncPolicy::OwnerWins>()) {
+            auto& stagingStorage = Staging.storage<ComponentType>();
+            StagingResultColumn& column = outResults.Columns[entt::type_hash<ComponentType>::value()];
+
+            // slot comes back with an older block in it
+            column.Entities.clear();
+            column.Values.clear();
+
+            ForEachChanged(Staging, GetStagingChanges<ComponentType>(), [&](entt::entity inEntity) {
+                if(!stagingStorage.contains(inEntity)) {
+                    return;
+                }
+
+                const ComponentType& staging = stagingStorage.get(inEntity);
+                column.Entities.push_back(inEntity);
+
+                ForEachSyncField<ComponentType>([&](auto inField) {
+                    using Field = decltype(inField);
+
+                    if constexpr (Field::FieldPolicy != SyncPolicy::Copy) {
+                        using FieldType = std::decay_t<decltype(std::declval<ComponentType&>().*Field::Member)>;
+                        static_assert(std::is_trivially_copyable_v<FieldType>, "Physics results are published as plain bytes");
+
+                        const std::size_t offset = column.Values.size();
+                        column.Values.resize(offset + sizeof(FieldType));
+                        std::memcpy(column.Values.data() + offset, &(staging.*Field::Member), sizeof(FieldType));
+                    }
+                });
+            });
+        }
+    }
+
+    template<typename ComponentType>
+    void MeowEngine::EnttBuffer::PullResultsFromStaging(const StagingResultBlock& inResults) {
+        if constexpr (HasSyncPolicy<ComponentType, SyncPolicy::DeltaMerge>() || HasSyncPolicy<ComponentType, SyncPolicy::OwnerWins>()) {
+            auto columnIterator = inResults.Columns.find(entt::type_hash<ComponentType>::value());
+            if(columnIterator == inResults.Columns.end()) {
+                return;
+            }
+
+            const StagingResultColumn& column = columnIterator->second;
+            auto& currentStorage = GetCurrent().storage<ComponentType>();
+            DirtyBitset& currentChanges = GetCurrentChanges<ComponentType>();
+            const std::byte* values = column.Values.data();
+
+            // only what physics moved, resting entities keep their synced values
+            for(entt::entity entity : column.Entities) {
+                ComponentType* current = currentStorage.contains(entity) ? &currentStorage.get(entity) : nullptr;
+
+                ForEachSyncField<ComponentType>([&](auto inField) {
+                    using Field = decltype(inField);
+
+                    if constexpr (Field::FieldPolicy != SyncPolicy::Copy) {
+                        using FieldType = std::decay_t<decltype(std::declval<ComponentType&>().*Field::Member)>;
+
+                        if(current != nullptr) {
+                            std::memcpy(&(current->*Field::Member), values, sizeof(FieldType));
+                        }
+                        values += sizeof(FieldType);
+                    }
+                });
+
+                if(current != nullptr) {
+                    currentChanges.Mark(entt::to_entity(entity));
+                }
+            }
+        }
+    }
+
+    template<typename ComponentType>
+    void MeowEngine::EnttBuffer::SyncChangesToFinal() {
+        auto& currentStorage = GetCurrent().storage<ComponentType>();
+        auto& finalStorage = GetFinal().storage<ComponentType>();
+        DirtyBitset& changes = GetCurrentChanges<ComponentType>();
+
+        auto copyFields = [](const ComponentType& inCurrent, ComponentType& inFinal) {
+            ForEachSyncField<ComponentType>([&](auto inField) {
+                inFinal.*decltype(inField)::Member = inCurrent.*decltype(inField)::Member;
+            });
+        };
 
-        ComponentToAddOnStagingQueue.enqueue([&, inEntity, inArgTuple = std::make_tuple(std::forward<Args>(inArgs)...)](MeowEngine::simulator::Physics* inPhysics) {
-            std::apply([&](auto&&... inUnpacked) {
+        if(changes.GetCount() * 4 >= currentStorage.size() && currentStorage.size() == finalStorage.size()) {
+            // most entities changed, so sweep both storages as arrays. Current & final are filled in the same order,
+            // packed positions line up & no per entity lookup is needed. Unchanged entities already match.
+            auto finalIterator = finalStorage.each().begin();
 
-                Staging.emplace<Type>(inEntity, std::forward<decltype(inUnpacked)>(inUnpacked)...);
-            }, inArgTuple);
-            if(Staging.all_of<entity::Transform3DComponent, entity::ColliderComponent, entity::RigidbodyComponent>(inEntity)) {
-                auto [transform, collider, rigidbody] =  Staging.get<entity::Transform3DComponent, entity::ColliderComponent, entity::RigidbodyComponent>(inEntity);
-                inPhysics->AddRigidbody(transform, collider, rigidbody);
+            for(auto [entity, current] : currentStorage.each()) {
+                auto [finalEntity, final] = *finalIterator;
+                ++finalIterator;
+
+                if(entity == finalEntity) {
+                    copyFields(current, final);
+                }
+                else if(finalStorage.contains(entity)) {
+                    copyFields(current, finalStorage.get(entity));
+                }
+            }
+        }
+        else {
+            ForEachChanged(GetCurrent(), changes, [&](entt::entity inEntity) {
+                if(currentStorage.contains(inEntity) && finalStorage.contains(inEntity)) {
+                    copyFields(currentStorage.get(inEntity), finalStorage.get(inEntity));
+                }
+            });
+        }
+
+        changes.Clear();
+    }
+
+    template<typename ComponentType>
+    MeowEngine::DirtyBitset& MeowEngine::EnttBuffer::GetCurrentChanges() {
+        return CurrentChanges.at(entt::type_hash<ComponentType>::value());
+    }
+
+    template<typename ComponentType>
+    MeowEngine::DirtyBitset& MeowEngine::EnttBuffer::GetStagingChanges() {
+        return StagingChanges.at(entt::type_hash<ComponentType>::value());
+    }
+
+    template<typename Callback>
+    void MeowEngine::EnttBuffer::ForEachChanged(const entt::registry& inRegistry, const DirtyBitset& inChanges, Callback&& inCallback) {
+        using EntityTraits = entt::entt_traits<entt::entity>;
+
+        inChanges.ForEach([&](std::size_t inIndex) {
+            const auto index = static_cast<EntityTraits::entity_type>(inIndex);
+            const entt::entity entity = EntityTraits::construct(index, inRegistry.current(static_cast<entt::entity>(index)));
+
+            if(inRegistry.valid(entity)) {
+                inCallback(entity);
             }
         });
     }
+
+    template<typename... ComponentTypes>
+    void MeowEngine::EnttBuffer::ReserveComponents(entt::registry& inRegistry, std::size_t inCount) {
+        (inRegistry.storage<ComponentTypes>().reserve(inRegistry.storage<ComponentTypes>().size() + inCount), ...);
+    }
 }
 
 
@@ -0,0 +1,199 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_FRAME_RING_HPP
+#define MEOWENGINE_FRAME_RING_HPP
+
+#include "atomic"
+#include "array"
+#include "cstdint"
+#include "cstddef"
+
+namespace MeowEngine {
+    /**
+     * N slots of frame data, every slot is tagged with the frame index it holds.
+     *
+     * Two ways to use it, don't mix them on one ring:
+     *
+     *  Stages - Get(0) is the writer's frame, Get(1) the frame before it & so on. Rotate() hands every slot to the
+     *           next stage & recycles the oldest one as the new writer frame. Only indices move, slots are never copied.
+     *           Caller makes sure no stage is touching the ring while rotating (i.e. at a frame barrier).
+     *           DoubleBuffer / TripleBuffer are 2 / 3 stage rings.
+     *
+     *  Acquire / Publish - one writer & up to ReaderCount readers run without a shared sync point.
+     *           Writer fills AcquireWrite() & PublishWrite()s it, readers pin the latest published slot with AcquireRead()
+     *           until ReleaseRead(). Writer always finds a slot that no reader holds, so nobody waits.
+     *
+     * @tparam Type slot data
+     * @tparam SlotCount frames in flight, more slots = more throughput & more latency
+     * @tparam ReaderCount readers for acquire / publish, needs SlotCount >= ReaderCount + 2
+     */
+    template <typename Type, std::size_t SlotCount, std::size_t ReaderCount = SlotCount - 2>
+    class FrameRing {
+        static_assert(SlotCount >= 2, "FrameRing needs at least 2 slots");
+
+    public:
+        static constexpr int NoSlot = -1;
+
+        FrameRing()
+        : Slots{}
+        , Head(0)
+        , FrameIndex(SlotCount - 1)
+        , LatestSlot(NoSlot)
+        , WriteSlot(NoSlot)
+        , WriteFrameIndex(0) {
+            // stage s starts on frame (SlotCount - 1 - s), so writer is on the newest frame
+            for(std::size_t i = 0; i < SlotCount; i++) {
+                SlotFrameIndices[i] = SlotCount - 1 - i;
+                SlotReaderCounts[i].store(0, std::memory_order_relaxed);
+            }
+
+            for(std::size_t i = 0; i < ReaderCount; i++) {
+                ReaderSlots[i] = NoSlot;
+                ReaderFrameIndices[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        // stages -----------------------------------------------------------------------
+
+        Type& Get(std::size_t inStage) {
+            return Slots[GetStageSlot(inStage)];
+        }
+
+        const Type& Get(std::size_t inStage) const {
+            return Slots[GetStageSlot(inStage)];
+        }
+
+        /**
+         * Frame index stage is working on, stage 0 is always the newest
+         */
+        uint64_t GetFrameIndex(std::size_t inStage) const {
+            return SlotFrameIndices[GetStageSlot(inStage)];
+        }
+
+        /**
+         * Stage s takes over the slot of stage s - 1, last stage's slot becomes the writer's next frame
+         */
+        void Rotate() {
+            Head = (Head + SlotCount - 1) % SlotCount;
+            SlotFrameIndices[Head] = ++FrameIndex;
+        }
+
+        // acquire / publish ------------------------------------------------------------
+
+        /**
+         * Writer only. Slot to fill for next frame, it's never the latest published or one pinned by a reader.
+         * Returns nullptr only if SlotCount is too small for the readers holding slots.
+         */
+        Type* AcquireWrite() {
+            const int latestSlot = LatestSlot.load(std::memory_order_seq_cst);
+
+            for(std::size_t i = 0; i < SlotCount; i++) {
+                if(static_cast<int>(i) == latestSlot) {
+                    continue;
+                }
+
+                // readers bump their count before re-checking latest, so a zero here can't be raced
+                if(SlotReaderCounts[i].load(std::memory_order_seq_cst) == 0) {
+                    WriteSlot = static_cast<int>(i);
+                    WriteFrameIndex = ++FrameIndex;
+                    SlotFrameIndices[i] = WriteFrameIndex;
+                    return &Slots[i];
+                }
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * Writer only. Makes the acquired slot the one readers pick up next.
+         */
+        void PublishWrite() {
+            if(WriteSlot == NoSlot) {
+                return;
+            }
+
+            LatestSlot.store(WriteSlot, std::memory_order_seq_cst);
+            WriteSlot = NoSlot;
+        }
+
+        /**
+         * Pins latest published slot for a reader until ReleaseRead, returns nullptr if nothing was published yet.
+         * Calling it again without release moves the reader to the latest slot.
+         */
+        const Type* AcquireRead(std::size_t inReader) {
+            ReleaseRead(inReader);
+
+            while(true) {
+                const int latestSlot = LatestSlot.load(std::memory_order_seq_cst);
+
+                if(latestSlot == NoSlot) {
+                    return nullptr;
+                }
+
+                SlotReaderCounts[latestSlot].fetch_add(1, std::memory_order_seq_cst);
+
+                // writer may have published & reused the slot between our load and pin, retry on the new latest
+                if(LatestSlot.load(std::memory_order_seq_cst) == latestSlot) {
+                    ReaderSlots[inReader] = latestSlot;
+                    ReaderFrameIndices[inReader].store(SlotFrameIndices[latestSlot], std::memory_order_relaxed);
+                    return &Slots[latestSlot];
+                }
+
+                SlotReaderCounts[latestSlot].fetch_sub(1, std::memory_order_seq_cst);
+            }
+        }
+
+        void ReleaseRead(std::size_t inReader) {
+            const int readerSlot = ReaderSlots[inReader];
+
+            if(readerSlot == NoSlot) {
+                return;
+            }
+
+            SlotReaderCounts[readerSlot].fetch_sub(1, std::memory_order_seq_cst);
+            ReaderSlots[inReader] = NoSlot;
+        }
+
+        /**
+         * Frame index a reader last acquired, readable from any thread
+         */
+        uint64_t GetReaderFrameIndex(std::size_t inReader) const {
+            return ReaderFrameIndices[inReader].load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Frame index writer is filling / last filled
+         */
+        uint64_t GetWriteFrameIndex() const {
+            return WriteFrameIndex;
+        }
+
+    private:
+        std::size_t GetStageSlot(std::size_t inStage) const {
+            return (Head + inStage) % SlotCount;
+        }
+
+        std::array<Type, SlotCount> Slots;
+        std::array<uint64_t, SlotCount> SlotFrameIndices;
+
+        // stages
+        std::size_t Head;
+        uint64_t FrameIndex;
+
+        // acquire / publish
+        std::atomic<int> LatestSlot;
+        std::array<std::atomic<uint32_t>, SlotCount> SlotReaderCounts;
+
+        // writer thread only
+        int WriteSlot;
+        uint64_t WriteFrameIndex;
+
+        // each reader only touches its own slot, frame index is shared for reporting
+        std::array<int, ReaderCount> ReaderSlots;
+        std::array<std::atomic<uint64_t>, ReaderCount> ReaderFrameIndices;
+    };
+}
+
+#endif //MEOWENGINE_FRAME_RING_HPP
@@ -0,0 +1,71 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_MAILBOX_HPP
+#define MEOWENGINE_MAILBOX_HPP
+
+#include "atomic"
+#include "array"
+#include "cstdint"
+
+namespace MeowEngine {
+    /**
+     * Lock free triple buffer between one writer & one reader thread.
+     * Writer fills GetWrite() & publishes it, reader picks up the newest published slot with Read().
+     * Both sides only do a single atomic exchange & never wait, a block published twice before a read replaces
+     * the older one, so whatever has to survive that has to be carried in every block.
+     * Writer's slot after publishing holds an older block, it has to be rewritten fully before the next publish.
+     */
+    template<typename Type>
+    class Mailbox {
+    public:
+        Mailbox()
+        : Slots{}
+        , Middle(1)
+        , WriteIndex(0)
+        , ReadIndex(2) {}
+
+        /**
+         * Writer only
+         */
+        Type& GetWrite() {
+            return Slots[WriteIndex];
+        }
+
+        /**
+         * Writer only. Swaps write slot with the middle one, marked as fresh for the reader.
+         */
+        void Publish() {
+            WriteIndex = Middle.exchange(WriteIndex | FreshBit, std::memory_order_acq_rel) & IndexMask;
+        }
+
+        /**
+         * Reader only. Newest block if one was published since last read, else nullptr.
+         * Block stays valid until the next Read.
+         */
+        const Type* Read() {
+            if((Middle.load(std::memory_order_relaxed) & FreshBit) == 0) {
+                return nullptr;
+            }
+
+            ReadIndex = Middle.exchange(ReadIndex, std::memory_order_acq_rel) & IndexMask;
+            return &Slots[ReadIndex];
+        }
+
+    private:
+        static constexpr uint8_t FreshBit = 4;
+        static constexpr uint8_t IndexMask = 3;
+
+        std::array<Type, 3> Slots;
+
+        // index of the slot between writer & reader, FreshBit set while reader hasn't taken it
+        alignas(64) std::atomic<uint8_t> Middle;
+
+        // each is touched by its own thread only
+        alignas(64) uint8_t WriteIndex;
+        alignas(64) uint8_t ReadIndex;
+    };
+}
+
+#endif //MEOWENGINE_MAILBOX_HPP
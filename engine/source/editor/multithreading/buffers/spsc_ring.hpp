@@ -0,0 +1,84 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_SPSC_RING_HPP
+#define MEOWENGINE_SPSC_RING_HPP
+
+#include "atomic"
+#include "array"
+#include "cstdint"
+#include "cstddef"
+
+namespace MeowEngine {
+    /**
+     * Fixed capacity single producer / single consumer ring, never allocates after construction.
+     * Producer & consumer indices sit on separate cache lines so each thread only writes its own line.
+     * @tparam Type trivially copyable item
+     * @tparam Capacity must be power of 2
+     */
+    template<typename Type, std::size_t Capacity>
+    class SpscRing {
+        static_assert((Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be power of 2");
+
+    public:
+        SpscRing()
+        : Head(0)
+        , Tail(0)
+        , OverflowCount(0) {}
+
+        /**
+         * Producer only. Returns false & counts an overflow when full, item is dropped.
+         */
+        bool Push(const Type& inItem) {
+            const uint64_t tail = Tail.load(std::memory_order_relaxed);
+
+            if(tail - Head.load(std::memory_order_acquire) >= Capacity) {
+                OverflowCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            Items[tail & Mask] = inItem;
+            Tail.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * Consumer only.
+         */
+        bool Pop(Type& outItem) {
+            const uint64_t head = Head.load(std::memory_order_relaxed);
+
+            if(head == Tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            outItem = Items[head & Mask];
+            Head.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        std::size_t SizeApprox() const {
+            return static_cast<std::size_t>(Tail.load(std::memory_order_relaxed) - Head.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * Items dropped because consumer fell behind by a full ring
+         */
+        uint64_t GetOverflowCount() const {
+            return OverflowCount.load(std::memory_order_relaxed);
+        }
+
+    private:
+        static constexpr uint64_t Mask = Capacity - 1;
+
+        alignas(64) std::atomic<uint64_t> Head;
+        alignas(64) std::atomic<uint64_t> Tail;
+        alignas(64) std::atomic<uint64_t> OverflowCount;
+        std::array<Type, Capacity> Items;
+    };
+}
+
+#endif //MEOWENGINE_SPSC_RING_HPP
@@ -0,0 +1,101 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "staging_command_buffer.hpp"
+
+MeowEngine::StagingCommandBuffer::StagingCommandBuffer()
+: Frames()
+, Recording(&Frames[0]) {
+    for(std::size_t i = 1; i < FrameCount; i++) {
+        FreeFrames.Push(&Frames[i]);
+    }
+}
+
+std::span<const entt::entity> MeowEngine::StagingCommandBuffer::CopyEntities(std::span<const entt::entity> inEntities) {
+    return {Recording->Arena.CreateRange<entt::entity>(inEntities.begin(), inEntities.size()), inEntities.size()};
+}
+
+void MeowEngine::StagingCommandBuffer::RecordCreate(std::span<const entt::entity> inEntities) {
+    Push({
+        StagingCommandKind::CreateEntities, 0, &ApplyCreateGroup,
+        inEntities.data(), nullptr, static_cast<uint32_t>(inEntities.size()), 0
+    });
+}
+
+void MeowEngine::StagingCommandBuffer::RecordDestroy(std::span<const entt::entity> inEntities) {
+    Push({
+        StagingCommandKind::DestroyEntities, 0, &ApplyDestroyGroup,
+        inEntities.data(), nullptr, static_cast<uint32_t>(inEntities.size()), 0
+    });
+}
+
+void MeowEngine::StagingCommandBuffer::Push(const StagingCommand& inCommand) {
+    const bool isRemoval = inCommand.Kind == StagingCommandKind::DestroyEntities || inCommand.Kind == StagingCommandKind::RemoveComponents;
+
+    if(isRemoval && Recording->HasAdditions) {
+        Recording->SegmentStarts.push_back(Recording->Commands.size());
+        Recording->HasAdditions = false;
+    }
+    else if(!isRemoval) {
+        Recording->HasAdditions = true;
+    }
+
+    Recording->Commands.push_back(inCommand);
+}
+
+void MeowEngine::StagingCommandBuffer::ApplyCreateGroup(entt::registry& inRegistry, const StagingCommand* inCommands, std::size_t inCount) {
+    auto& entityStorage = inRegistry.storage<entt::entity>();
+
+    std::size_t entityCount = 0;
+    for(std::size_t i = 0; i < inCount; i++) {
+        entityCount += inCommands[i].EntityCount;
+    }
+    entityStorage.reserve(entityStorage.size() + entityCount);
+
+    // main's ids are used as hints, staging always has the same slots free so it gets the same ids
+    for(std::size_t i = 0; i < inCount; i++) {
+        for(uint32_t j = 0; j < inCommands[i].EntityCount; j++) {
+            inRegistry.create(inCommands[i].Entities[j]);
+        }
+    }
+}
+
+void MeowEngine::StagingCommandBuffer::ApplyDestroyGroup(entt::registry& inRegistry, const StagingCommand* inCommands, std::size_t inCount) {
+    for(std::size_t i = 0; i < inCount; i++) {
+        for(uint32_t j = 0; j < inCommands[i].EntityCount; j++) {
+            const entt::entity entity = inCommands[i].Entities[j];
+
+            // version check, an id main already recycled or removed twice is skipped
+            if(inRegistry.valid(entity)) {
+                inRegistry.destroy(entity);
+            }
+        }
+    }
+}
+
+void MeowEngine::StagingCommandBuffer::ApplyRemoveGroup(entt::registry& inRegistry, const StagingCommand* inCommands, std::size_t inCount) {
+    auto* storage = inRegistry.storage(inCommands[0].ComponentType);
+
+    if(storage == nullptr) {
+        return;
+    }
+
+    for(std::size_t i = 0; i < inCount; i++) {
+        storage->remove(inCommands[i].Entities, inCommands[i].Entities + inCommands[i].EntityCount);
+    }
+}
+
+void MeowEngine::StagingCommandBuffer::Submit() {
+    if(Recording->Commands.empty()) {
+        return;
+    }
+
+    CommandFrame* next;
+    if(!FreeFrames.Pop(next)) {
+        return;
+    }
+
+    SubmittedFrames.Push(Recording);
+    Recording = next;
+}
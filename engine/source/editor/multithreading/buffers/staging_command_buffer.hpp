@@ -0,0 +1,273 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_STAGING_COMMAND_BUFFER_HPP
+#define MEOWENGINE_STAGING_COMMAND_BUFFER_HPP
+
+#include "entt_wrapper.hpp"
+#include "command_arena.hpp"
+#include "spsc_ring.hpp"
+#include "array"
+#include "vector"
+#include "span"
+#include "algorithm"
+#include "cstdint"
+#include "type_traits"
+
+namespace MeowEngine {
+    /**
+     * Applied in this order within a segment, see StagingCommandBuffer
+     */
+    enum class StagingCommandKind : uint8_t {
+        DestroyEntities,
+        RemoveComponents,
+        CreateEntities,
+        AddComponents
+    };
+
+    /**
+     * One staging record, entities & values live in its frame's arena.
+     * ValueCount is 1 when every entity gets a copy of the same value, else there is a value per entity.
+     */
+    struct StagingCommand {
+        StagingCommandKind Kind;
+        entt::id_type ComponentType;
+
+        /**
+         * Applies a run of commands sharing kind & ComponentType
+         */
+        void (*ApplyGroup)(entt::registry&, const StagingCommand*, std::size_t);
+
+        const entt::entity* Entities;
+        const void* Values;
+        uint32_t EntityCount;
+        uint32_t ValueCount;
+    };
+
+    static_assert(std::is_trivially_copyable_v<StagingCommand>, "StagingCommand is copied around as plain data");
+
+    /**
+     * Entity & component add / remove commands from main(producer) to physics(consumer).
+     * Main records into the current frame's arena & submits it once per frame, physics applies every submitted frame
+     * in one pass grouped by kind & component type. Applied frames go back to main through a free ring, so once warmed
+     * up recording doesn't allocate. If physics falls behind main keeps recording into the same frame.
+     *
+     * A removal recorded after any addition starts a new segment. Segments apply in order, so a recycled entity id
+     * is never created on staging before its previous version is destroyed.
+     */
+    class StagingCommandBuffer {
+    public:
+        StagingCommandBuffer();
+
+        StagingCommandBuffer(const StagingCommandBuffer&) = delete;
+        StagingCommandBuffer& operator=(const StagingCommandBuffer&) = delete;
+
+        /**
+         * Main thread. Copies entity ids into the frame so several records of a batch can share them.
+         */
+        std::span<const entt::entity> CopyEntities(std::span<const entt::entity> inEntities);
+
+        /**
+         * Main thread. Entities are created with the same ids, inEntities should come from CopyEntities.
+         */
+        void RecordCreate(std::span<const entt::entity> inEntities);
+
+        /**
+         * Main thread. Stale ids are skipped on apply, inEntities should come from CopyEntities.
+         */
+        void RecordDestroy(std::span<const entt::entity> inEntities);
+
+        /**
+         * Main thread. Removes the component if the entity still has it.
+         */
+        template<typename ComponentType>
+        void RecordRemove(entt::entity inEntity);
+
+        /**
+         * Main thread. Component constructed from args for one entity.
+         */
+        template<typename ComponentType, typename... Args>
+        void Record(entt::entity inEntity, Args&&... inArgs);
+
+        /**
+         * Main thread. Every entity gets a copy of inValue, inEntities should come from CopyEntities.
+         */
+        template<typename ComponentType>
+        void RecordShared(std::span<const entt::entity> inEntities, const ComponentType& inValue);
+
+        /**
+         * Main thread. One value per entity, inEntities should come from CopyEntities.
+         */
+        template<typename ComponentType>
+        void RecordEach(std::span<const entt::entity> inEntities, std::span<const ComponentType> inValues);
+
+        /**
+         * Main thread. Hands recorded frame to physics, no-op when empty or when physics still holds every other frame.
+         */
+        void Submit();
+
+        /**
+         * Physics thread. Applies all submitted commands to inRegistry. inOnRemoving(command) runs right before a
+         * removal command is applied, inOnAdded(command) right after an add component command is applied.
+         */
+        template<typename RemovingCallback, typename AddedCallback>
+        void Apply(entt::registry& inRegistry, RemovingCallback&& inOnRemoving, AddedCallback&& inOnAdded);
+
+    private:
+        static constexpr std::size_t FrameCount = 4;
+
+        struct CommandFrame {
+            CommandArena Arena;
+            std::vector<StagingCommand> Commands;
+
+            // first command of every segment after the first one
+            std::vector<std::size_t> SegmentStarts;
+            bool HasAdditions = false;
+        };
+
+        void Push(const StagingCommand& inCommand);
+
+        template<typename RemovingCallback, typename AddedCallback>
+        static void ApplySegment(entt::registry& inRegistry, StagingCommand* inFirst, StagingCommand* inLast,
+                                 RemovingCallback& inOnRemoving, AddedCallback& inOnAdded);
+
+        template<typename ComponentType>
+        static void ApplyAddGroup(entt::registry& inRegistry, const StagingCommand* inCommands, std::size_t inCount);
+
+        static void ApplyCreateGroup(entt::registry& inRegistry, const StagingCommand* inCommands, std::size_t inCount);
+        static void ApplyDestroyGroup(entt::registry& inRegistry, const StagingCommand* inCommands, std::size_t inCount);
+        static void ApplyRemoveGroup(entt::registry& inRegistry, const StagingCommand* inCommands, std::size_t inCount);
+
+        std::array<CommandFrame, FrameCount> Frames;
+
+        // main thread only
+        CommandFrame* Recording;
+
+        SpscRing<CommandFrame*, FrameCount> SubmittedFrames;
+        SpscRing<CommandFrame*, FrameCount> FreeFrames;
+    };
+
+    template<typename ComponentType, typename... Args>
+    void StagingCommandBuffer::Record(entt::entity inEntity, Args&&... inArgs) {
+        const entt::entity* entity = Recording->Arena.Create<entt::entity>(inEntity);
+        const ComponentType* value = Recording->Arena.Create<ComponentType>(std::forward<Args>(inArgs)...);
+
+        Push({
+            StagingCommandKind::AddComponents, entt::type_hash<ComponentType>::value(), &ApplyAddGroup<ComponentType>,
+            entity, value, 1, 1
+        });
+    }
+
+    template<typename ComponentType>
+    void StagingCommandBuffer::RecordShared(std::span<const entt::entity> inEntities, const ComponentType& inValue) {
+        const ComponentType* value = Recording->Arena.Create<ComponentType>(inValue);
+
+        Push({
+            StagingCommandKind::AddComponents, entt::type_hash<ComponentType>::value(), &ApplyAddGroup<ComponentType>,
+            inEntities.data(), value, static_cast<uint32_t>(inEntities.size()), 1
+        });
+    }
+
+    template<typename ComponentType>
+    void StagingCommandBuffer::RecordEach(std::span<const entt::entity> inEntities, std::span<const ComponentType> inValues) {
+        const ComponentType* values = Recording->Arena.CreateRange<ComponentType>(inValues.begin(), inValues.size());
+
+        Push({
+            StagingCommandKind::AddComponents, entt::type_hash<ComponentType>::value(), &ApplyAddGroup<ComponentType>,
+            inEntities.data(), values, static_cast<uint32_t>(inEntities.size()), static_cast<uint32_t>(inValues.size())
+        });
+    }
+
+    template<typename ComponentType>
+    void StagingCommandBuffer::RecordRemove(entt::entity inEntity) {
+        const entt::entity* entity = Recording->Arena.Create<entt::entity>(inEntity);
+
+        Push({
+            StagingCommandKind::RemoveComponents, entt::type_hash<ComponentType>::value(), &ApplyRemoveGroup,
+            entity, nullptr, 1, 0
+        });
+    }
+
+    template<typename RemovingCallback, typename AddedCallback>
+    void StagingCommandBuffer::Apply(entt::registry& inRegistry, RemovingCallback&& inOnRemoving, AddedCallback&& inOnAdded) {
+        CommandFrame* frame;
+
+        while(SubmittedFrames.Pop(frame)) {
+            std::vector<StagingCommand>& commands = frame->Commands;
+            StagingCommand* first = commands.data();
+
+            for(std::size_t segmentStart : frame->SegmentStarts) {
+                ApplySegment(inRegistry, first, commands.data() + segmentStart, inOnRemoving, inOnAdded);
+                first = commands.data() + segmentStart;
+            }
+            ApplySegment(inRegistry, first, commands.data() + commands.size(), inOnRemoving, inOnAdded);
+
+            commands.clear();
+            frame->SegmentStarts.clear();
+            frame->HasAdditions = false;
+            frame->Arena.Reset();
+            FreeFrames.Push(frame);
+        }
+    }
+
+    template<typename RemovingCallback, typename AddedCallback>
+    void StagingCommandBuffer::ApplySegment(entt::registry& inRegistry, StagingCommand* inFirst, StagingCommand* inLast,
+                                            RemovingCallback& inOnRemoving, AddedCallback& inOnAdded) {
+        // inside a segment an entity gets each component type once, so order inside a group doesn't matter
+        // & sort stays in place
+        std::sort(inFirst, inLast, [](const StagingCommand& inA, const StagingCommand& inB) {
+            return inA.Kind != inB.Kind ? inA.Kind < inB.Kind : inA.ComponentType < inB.ComponentType;
+        });
+
+        for(StagingCommand* group = inFirst; group != inLast;) {
+            StagingCommand* groupEnd = group + 1;
+            while(groupEnd != inLast && groupEnd->Kind == group->Kind && groupEnd->ComponentType == group->ComponentType) {
+                ++groupEnd;
+            }
+
+            const bool isRemoval = group->Kind == StagingCommandKind::DestroyEntities || group->Kind == StagingCommandKind::RemoveComponents;
+
+            if(isRemoval) {
+                for(StagingCommand* command = group; command != groupEnd; ++command) {
+                    inOnRemoving(*command);
+                }
+            }
+
+            group->ApplyGroup(inRegistry, group, groupEnd - group);
+
+            if(group->Kind == StagingCommandKind::AddComponents) {
+                for(StagingCommand* command = group; command != groupEnd; ++command) {
+                    inOnAdded(*command);
+                }
+            }
+
+            group = groupEnd;
+        }
+    }
+
+    template<typename ComponentType>
+    void StagingCommandBuffer::ApplyAddGroup(entt::registry& inRegistry, const StagingCommand* inCommands, std::size_t inCount) {
+        auto& storage = inRegistry.storage<ComponentType>();
+
+        std::size_t entityCount = 0;
+        for(std::size_t i = 0; i < inCount; i++) {
+            entityCount += inCommands[i].EntityCount;
+        }
+        storage.reserve(storage.size() + entityCount);
+
+        for(std::size_t i = 0; i < inCount; i++) {
+            const StagingCommand& command = inCommands[i];
+            const ComponentType* values = static_cast<const ComponentType*>(command.Values);
+
+            if(command.ValueCount == 1) {
+                inRegistry.insert<ComponentType>(command.Entities, command.Entities + command.EntityCount, values[0]);
+            }
+            else {
+                inRegistry.insert<ComponentType>(command.Entities, command.Entities + command.EntityCount, values);
+            }
+        }
+    }
+}
+
+#endif //MEOWENGINE_STAGING_COMMAND_BUFFER_HPP
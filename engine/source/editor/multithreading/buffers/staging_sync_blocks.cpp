@@ -0,0 +1,5 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "staging_sync_blocks.hpp"
@@ -0,0 +1,64 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_STAGING_SYNC_BLOCKS_HPP
+#define MEOWENGINE_STAGING_SYNC_BLOCKS_HPP
+
+#include "entt_wrapper.hpp"
+#include "vector"
+#include "unordered_map"
+#include "cstddef"
+#include "cstdint"
+
+namespace MeowEngine {
+    /**
+     * Main's change of one DeltaMerge field, Apply adds Value to the field's staging delta target
+     */
+    struct StagingDelta {
+        entt::entity Entity;
+
+        // main sync it was recorded on, physics applies every frame once
+        uint64_t Frame;
+
+        void (*Apply)(entt::registry&, entt::entity, const void*);
+        alignas(16) std::byte Value[16];
+    };
+
+    /**
+     * Main -> physics. Carries every delta physics hasn't acknowledged yet, so a block replaced before physics read
+     * it loses nothing.
+     */
+    struct StagingDeltaBlock {
+        uint64_t LastFrame = 0;
+
+        // newest result block main has applied
+        uint64_t AckedResultStep = 0;
+
+        std::vector<StagingDelta> Deltas;
+    };
+
+    /**
+     * Physics owned fields of one component type, packed per entity in SyncTraits order
+     */
+    struct StagingResultColumn {
+        std::vector<entt::entity> Entities;
+        std::vector<std::byte> Values;
+    };
+
+    /**
+     * Physics -> main. Carries every entity physics moved since main's last acknowledged step, so a block replaced
+     * before main read it loses nothing.
+     */
+    struct StagingResultBlock {
+        uint64_t Step = 0;
+
+        // newest delta frame physics has applied
+        uint64_t AppliedDeltaFrame = 0;
+
+        // keyed by entt type hash
+        std::unordered_map<entt::id_type, StagingResultColumn> Columns;
+    };
+}
+
+#endif //MEOWENGINE_STAGING_SYNC_BLOCKS_HPP
@@ -0,0 +1,89 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_SYNC_TRAITS_HPP
+#define MEOWENGINE_SYNC_TRAITS_HPP
+
+#include "tuple"
+#include "type_traits"
+#include "entt_wrapper.hpp"
+
+namespace MeowEngine {
+    /**
+     * Who owns a component field across current(main), final(render) & staging(physics)
+     */
+    enum class SyncPolicy {
+        // main owns it, render gets a copy every sync, physics never reads it
+        Copy,
+        // main & physics both write, main's change since last sync goes to physics as a delta & physics result wins
+        DeltaMerge,
+        // physics owns it, staging value overwrites main & render, main edits are dropped
+        OwnerWins
+    };
+
+    /**
+     * One synced field
+     * @tparam MemberPointer &Component::Field
+     * @tparam Policy SyncPolicy
+     * @tparam DeltaTargetType staging component receiving DeltaMerge deltas with AddDelta(delta)
+     */
+    template<auto MemberPointer, SyncPolicy Policy, typename DeltaTargetType = void>
+    struct SyncField {
+        static constexpr auto Member = MemberPointer;
+        static constexpr SyncPolicy FieldPolicy = Policy;
+        using DeltaTarget = DeltaTargetType;
+    };
+
+    /**
+     * Specialize per component with `using Fields = std::tuple<SyncField<..>, ..>;`
+     * EnttBuffer generates sync passes from it, components without traits aren't synced.
+     */
+    template<typename ComponentType>
+    struct SyncTraits {
+        using Fields = std::tuple<>;
+    };
+
+    /**
+     * Whether staging(physics) registry keeps a copy of the component, specialize with IsStaged = true for the ones
+     * physics reads. Everything else only lives on current(main) & final(render).
+     */
+    template<typename ComponentType>
+    struct StagingTraits {
+        static constexpr bool IsStaged = false;
+    };
+
+    /**
+     * Compile time set of components, answers both for templates & for type erased code holding an entt type hash
+     */
+    template<typename... ComponentTypes>
+    struct ComponentList {
+        template<typename ComponentType>
+        static constexpr bool Contains = (std::is_same_v<ComponentType, ComponentTypes> || ...);
+
+        static bool ContainsType(entt::id_type inComponentType) {
+            return ((entt::type_hash<ComponentTypes>::value() == inComponentType) || ...);
+        }
+    };
+
+    /**
+     * Calls inCallback(SyncField{}) for every field of the component's traits
+     */
+    template<typename ComponentType, typename Callback>
+    constexpr void ForEachSyncField(Callback&& inCallback) {
+        std::apply([&](auto... inFields) {
+            (inCallback(inFields), ...);
+        }, typename SyncTraits<ComponentType>::Fields{});
+    }
+
+    template<typename ComponentType, SyncPolicy Policy>
+    constexpr bool HasSyncPolicy() {
+        bool hasPolicy = false;
+        ForEachSyncField<ComponentType>([&](auto inField) {
+            hasPolicy |= decltype(inField)::FieldPolicy == Policy;
+        });
+        return hasPolicy;
+    }
+}
+
+#endif //MEOWENGINE_SYNC_TRAITS_HPP
@@ -6,6 +6,7 @@
 #define MEOWENGINE_TRIPLE_BUFFER_HPP
 
 #include "utility"
+#include "frame_ring.hpp"
 
 using namespace std;
 
@@ -14,29 +15,45 @@ namespace MeowEngine {
     struct TripleBuffer {
 
     public:
-        TripleBuffer() : Current{}, Staging{}, Final{} {}
+        TripleBuffer() : Ring() {}
 
         T& GetCurrent() {
-            return  Current;
+            return Ring.Get(CurrentStage);
         }
 
         T& GetStaging() {
-            return  Staging;
+            return Ring.Get(StagingStage);
         }
 
         T& GetFinal() {
-            return  Final;
+            return Ring.Get(FinalStage);
         }
 
+        uint64_t GetCurrentFrameIndex() const {
+            return Ring.GetFrameIndex(CurrentStage);
+        }
+
+        uint64_t GetStagingFrameIndex() const {
+            return Ring.GetFrameIndex(StagingStage);
+        }
+
+        uint64_t GetFinalFrameIndex() const {
+            return Ring.GetFrameIndex(FinalStage);
+        }
+
+        /**
+         * current -> staging -> final, final is recycled as current
+         */
         void Swap() {
-            std::swap(Current, Staging);
-            std::swap(Current, Final);
+            Ring.Rotate();
         }
 
     protected:
-        T Current;
-        T Staging;
-        T Final;
+        static constexpr std::size_t CurrentStage = 0;
+        static constexpr std::size_t StagingStage = 1;
+        static constexpr std::size_t FinalStage = 2;
+
+        MeowEngine::FrameRing<T, 3> Ring;
     };
 }
 
@@ -0,0 +1,189 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "frame_barrier.hpp"
+
+#include "chrono"
+#include "thread"
+#include "stdexcept"
+#include "tracy_wrapper.hpp"
+#include "log.hpp"
+
+namespace {
+    uint64_t GetTimeNanoseconds() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count());
+    }
+
+    inline void CpuRelax() {
+#if defined(__x86_64__) || defined(_M_X64)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+}
+
+MeowEngine::FrameBarrier::FrameBarrier(std::string inPhaseName, int inSpinCount)
+: PhaseName(std::move(inPhaseName))
+, SpinCount(inSpinCount)
+, State(0)
+, Generation(0)
+, ShouldEnd(false)
+, ParkedCount(0) {}
+
+int MeowEngine::FrameBarrier::Join(const std::string& inParticipantName) {
+    std::lock_guard<std::mutex> lock(JoinMutex);
+
+    for(int i = 0; i < MaxParticipantCount; i++) {
+        Participant& participant = Participants[i];
+
+        if(!participant.IsActive) {
+            participant.Name = inParticipantName;
+            participant.WaitCount = 0;
+            participant.TotalWaitTime = 0;
+            participant.MaxWaitTime = 0;
+            participant.LastWaitTime = 0;
+            participant.LastArrivalCount = 0;
+            participant.IsActive = true;
+
+            State.fetch_add(ParticipantOne, std::memory_order_acq_rel);
+            return i;
+        }
+    }
+
+    throw std::runtime_error("FrameBarrier:: " + PhaseName + " has no free participant slot");
+}
+
+void MeowEngine::FrameBarrier::Leave(int inParticipantId) {
+    {
+        std::lock_guard<std::mutex> lock(JoinMutex);
+        Participants[inParticipantId].IsActive = false;
+    }
+
+    const uint64_t previousState = State.fetch_sub(ParticipantOne, std::memory_order_acq_rel);
+    const uint64_t arrivedCount = previousState & ArrivedMask;
+    const uint64_t participantCount = (previousState >> 32) - 1;
+
+    // everyone left was only waiting on us
+    if(arrivedCount > 0 && arrivedCount == participantCount) {
+        ReleasePhase();
+    }
+}
+
+void MeowEngine::FrameBarrier::Wait(int inParticipantId) {
+    PT_PROFILE_SCOPE;
+    if(ShouldEnd.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    Participant& participant = Participants[inParticipantId];
+    const uint64_t arriveTime = ::GetTimeNanoseconds();
+
+    // generation has to be read before we arrive, the phase can't be released without us
+    const uint32_t generation = Generation.load(std::memory_order_acquire);
+    const uint64_t previousState = State.fetch_add(1, std::memory_order_acq_rel);
+
+    if((previousState & ArrivedMask) + 1 == (previousState >> 32)) {
+        // last one in
+        ReleasePhase();
+        RecordWait(participant, 0, true);
+        return;
+    }
+
+    for(int i = 0; i < SpinCount; i++) {
+        if(Generation.load(std::memory_order_acquire) != generation) {
+            RecordWait(participant, ::GetTimeNanoseconds() - arriveTime, false);
+            return;
+        }
+        ::CpuRelax();
+    }
+
+    {
+        PT_PROFILE_SCOPE_N("Barrier Parked");
+        std::unique_lock<std::mutex> lock(ParkMutex);
+        ParkedCount++;
+        ParkCondition.wait(lock, [this, generation] {
+            return Generation.load(std::memory_order_acquire) != generation || ShouldEnd.load();
+        });
+        ParkedCount--;
+    }
+
+    RecordWait(participant, ::GetTimeNanoseconds() - arriveTime, false);
+}
+
+void MeowEngine::FrameBarrier::End() {
+    {
+        std::lock_guard<std::mutex> lock(ParkMutex);
+        ShouldEnd = true;
+    }
+    ParkCondition.notify_all();
+}
+
+void MeowEngine::FrameBarrier::ReleasePhase() {
+    // keep participant count, clear arrivals before anyone can see the new generation
+    State.fetch_and(~ArrivedMask, std::memory_order_acq_rel);
+    Generation.fetch_add(1);
+
+    // taking the lock makes sure a thread that is about to park sees the new generation
+    if(ParkedCount.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(ParkMutex);
+        }
+        ParkCondition.notify_all();
+    }
+}
+
+void MeowEngine::FrameBarrier::RecordWait(Participant& inParticipant, uint64_t inWaitTime, bool inIsLastArrival) {
+    // only the owning thread writes, so relaxed load + store is enough
+    inParticipant.WaitCount.store(inParticipant.WaitCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    inParticipant.TotalWaitTime.store(inParticipant.TotalWaitTime.load(std::memory_order_relaxed) + inWaitTime, std::memory_order_relaxed);
+    inParticipant.LastWaitTime.store(inWaitTime, std::memory_order_relaxed);
+
+    if(inWaitTime > inParticipant.MaxWaitTime.load(std::memory_order_relaxed)) {
+        inParticipant.MaxWaitTime.store(inWaitTime, std::memory_order_relaxed);
+    }
+
+    if(inIsLastArrival) {
+        inParticipant.LastArrivalCount.store(inParticipant.LastArrivalCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+}
+
+const std::string& MeowEngine::FrameBarrier::GetPhaseName() const {
+    return PhaseName;
+}
+
+MeowEngine::FrameBarrierStatistics MeowEngine::FrameBarrier::GetStatistics(int inParticipantId) const {
+    const Participant& participant = Participants[inParticipantId];
+
+    return {
+        participant.Name,
+        participant.WaitCount.load(std::memory_order_relaxed),
+        participant.TotalWaitTime.load(std::memory_order_relaxed),
+        participant.MaxWaitTime.load(std::memory_order_relaxed),
+        participant.LastWaitTime.load(std::memory_order_relaxed),
+        participant.LastArrivalCount.load(std::memory_order_relaxed)
+    };
+}
+
+void MeowEngine::FrameBarrier::LogStatistics() const {
+    for(int i = 0; i < MaxParticipantCount; i++) {
+        const MeowEngine::FrameBarrierStatistics statistics = GetStatistics(i);
+        if(statistics.WaitCount == 0) {
+            continue;
+        }
+
+        const double averageWait = static_cast<double>(statistics.TotalWaitTime) / statistics.WaitCount / 1000000.0;
+        const double maxWait = static_cast<double>(statistics.MaxWaitTime) / 1000000.0;
+
+        MeowEngine::Log(
+            "Barrier " + PhaseName,
+            statistics.ParticipantName
+                + " avg wait " + std::to_string(averageWait) + "ms"
+                + ", max wait " + std::to_string(maxWait) + "ms"
+                + ", last to arrive " + std::to_string(statistics.LastArrivalCount) + "/" + std::to_string(statistics.WaitCount)
+        );
+    }
+}
@@ -0,0 +1,114 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_FRAME_BARRIER_HPP
+#define MEOWENGINE_FRAME_BARRIER_HPP
+
+#include "atomic"
+#include "array"
+#include "string"
+#include "mutex"
+#include "condition_variable"
+
+namespace MeowEngine {
+    /**
+     * Wait statistics of a single participant for a barrier phase, all times in nanoseconds
+     */
+    struct FrameBarrierStatistics {
+        std::string ParticipantName;
+        uint64_t WaitCount;
+        uint64_t TotalWaitTime;
+        uint64_t MaxWaitTime;
+        uint64_t LastWaitTime;
+
+        /**
+         * How many times this participant was the last to arrive, i.e. everyone else was waiting on it
+         */
+        uint64_t LastArrivalCount;
+    };
+
+    /**
+     * Generation counted frame barrier.
+     * Arrived count & participant count share one atomic, so arriving is a single fetch_add.
+     * Waiting threads spin for a bit and then park, a thread can only pass once the generation it arrived in is released,
+     * so a fast thread can't slip into the next phase.
+     * Participants can join / leave at any time, leaving releases the phase if everyone else has already arrived.
+     */
+    class FrameBarrier {
+    public:
+        static constexpr int MaxParticipantCount = 16;
+
+        /**
+         * @param inPhaseName used while reporting wait times
+         * @param inSpinCount times we poll generation before parking thread
+         */
+        explicit FrameBarrier(std::string inPhaseName, int inSpinCount = 4000);
+
+        /**
+         * Adds a participant, it's counted from current phase onwards
+         * @return id used for Wait / Leave / GetStatistics
+         */
+        int Join(const std::string& inParticipantName);
+
+        /**
+         * Removes a participant, releases waiting threads if it was the only one missing
+         */
+        void Leave(int inParticipantId);
+
+        /**
+         * Arrive at barrier & block till all participants arrive
+         */
+        void Wait(int inParticipantId);
+
+        /**
+         * Releases all waiting threads & makes every following Wait pass through
+         */
+        void End();
+
+        const std::string& GetPhaseName() const;
+        MeowEngine::FrameBarrierStatistics GetStatistics(int inParticipantId) const;
+        void LogStatistics() const;
+
+    private:
+        static constexpr uint64_t ArrivedMask = 0xFFFFFFFFull;
+        static constexpr uint64_t ParticipantOne = 1ull << 32;
+
+        struct Participant {
+            std::string Name;
+            std::atomic<bool> IsActive {false};
+            std::atomic<uint64_t> WaitCount {0};
+            std::atomic<uint64_t> TotalWaitTime {0};
+            std::atomic<uint64_t> MaxWaitTime {0};
+            std::atomic<uint64_t> LastWaitTime {0};
+            std::atomic<uint64_t> LastArrivalCount {0};
+        };
+
+        /**
+         * Resets arrived count & moves to next generation, waking parked threads
+         */
+        void ReleasePhase();
+
+        void RecordWait(Participant& inParticipant, uint64_t inWaitTime, bool inIsLastArrival);
+
+        const std::string PhaseName;
+        const int SpinCount;
+
+        /**
+         * (participant count << 32) | arrived count
+         */
+        std::atomic<uint64_t> State;
+        std::atomic<uint32_t> Generation;
+        std::atomic<bool> ShouldEnd;
+
+        std::array<Participant, MaxParticipantCount> Participants;
+        std::mutex JoinMutex;
+
+        // only used once spinning didn't get us through
+        std::atomic<int> ParkedCount;
+        std::mutex ParkMutex;
+        std::condition_variable ParkCondition;
+    };
+}
+
+#endif //MEOWENGINE_FRAME_BARRIER_HPP
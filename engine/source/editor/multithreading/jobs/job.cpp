@@ -0,0 +1,81 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "job.hpp"
+#include "thread"
+
+MeowEngine::JobCounter::JobCounter()
+: State(0)
+, Continuations() {}
+
+bool MeowEngine::JobCounter::IsDone() const {
+    return State.load(std::memory_order_acquire) == 0;
+}
+
+int MeowEngine::JobCounter::GetValue() const {
+    return static_cast<int>(State.load(std::memory_order_acquire) / CountOne);
+}
+
+void MeowEngine::JobCounter::Increment(int inCount) {
+    State.fetch_add(CountOne * inCount, std::memory_order_relaxed);
+}
+
+bool MeowEngine::JobCounter::Decrement(std::vector<Job*>& outContinuations) {
+    uint32_t state = State.load(std::memory_order_acquire);
+
+    while(true) {
+        if(state >= 2 * CountOne) {
+            // not the last job, lock bit doesn't matter
+            if(State.compare_exchange_weak(state, state - CountOne, std::memory_order_acq_rel)) {
+                return false;
+            }
+        }
+        else if(state & LockBit) {
+            // a continuation is being attached
+            std::this_thread::yield();
+            state = State.load(std::memory_order_acquire);
+        }
+        else if(State.compare_exchange_weak(state, state | LockBit, std::memory_order_acquire)) {
+            break;
+        }
+    }
+
+    outContinuations.swap(Continuations);
+
+    // unlock & reach zero in one step, waiters may free this counter right after
+    uint32_t lockedState = CountOne | LockBit;
+    if(State.compare_exchange_strong(lockedState, 0, std::memory_order_acq_rel)) {
+        return true;
+    }
+
+    // counter got reused while we were flushing, continuations now wait for the new cycle
+    Continuations.swap(outContinuations);
+    State.fetch_sub(CountOne | LockBit, std::memory_order_release);
+
+    return false;
+}
+
+bool MeowEngine::JobCounter::TryAddContinuation(Job* inJob) {
+    uint32_t state = State.load(std::memory_order_acquire);
+
+    while(true) {
+        // counter is already done, so there is nothing to wait for
+        if(state == 0) {
+            return false;
+        }
+
+        if(state & LockBit) {
+            std::this_thread::yield();
+            state = State.load(std::memory_order_acquire);
+        }
+        else if(State.compare_exchange_weak(state, state | LockBit, std::memory_order_acquire)) {
+            break;
+        }
+    }
+
+    Continuations.push_back(inJob);
+    State.fetch_and(~LockBit, std::memory_order_release);
+
+    return true;
+}
@@ -0,0 +1,114 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_JOB_HPP
+#define MEOWENGINE_JOB_HPP
+
+#include "atomic"
+#include "cstdint"
+#include "cstddef"
+#include "new"
+#include "type_traits"
+#include "utility"
+#include "vector"
+
+namespace MeowEngine {
+    struct Job;
+
+    /**
+     * Tracks number of unfinished jobs. Jobs submitted with a dependency on a counter
+     * are held back as continuations until the counter reaches zero.
+     * Count & a lock bit share one atomic, so the job finishing the counter never touches it
+     * after waiters can see it done (counters can live on the stack of the waiting thread).
+     */
+    class JobCounter {
+    public:
+        JobCounter();
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool IsDone() const;
+        int GetValue() const;
+
+    private:
+        friend class JobSystem;
+
+        void Increment(int inCount = 1);
+
+        /**
+         * @return true when counter reached zero & returns jobs waiting on this counter
+         */
+        bool Decrement(std::vector<Job*>& outContinuations);
+
+        /**
+         * @return false when counter is already done & job can be queued right away
+         */
+        bool TryAddContinuation(Job* inJob);
+
+        static constexpr uint32_t LockBit = 1;
+        static constexpr uint32_t CountOne = 2;
+
+        /**
+         * (count << 1) | lock bit
+         */
+        std::atomic<uint32_t> State;
+
+        // guarded by lock bit, only touched when a dependent job is submitted or when counter finishes
+        std::vector<Job*> Continuations;
+    };
+
+    /**
+     * Pooled by JobSystem. Task is stored inline, only tasks bigger than InlineSize go to the heap.
+     */
+    struct Job {
+        static constexpr std::size_t InlineSize = 48;
+
+        template<typename Function>
+        void SetTask(Function&& inTask);
+
+        void Run() {
+            Invoke(Storage);
+        }
+
+        /**
+         * Destroys the task, job can be reused after this
+         */
+        void ReleaseTask() {
+            if(Destroy != nullptr) {
+                Destroy(Storage);
+                Destroy = nullptr;
+            }
+        }
+
+        bool HasTask() const {
+            return Destroy != nullptr;
+        }
+
+        alignas(std::max_align_t) std::byte Storage[InlineSize];
+        void (*Invoke)(void* inStorage) = nullptr;
+        void (*Destroy)(void* inStorage) = nullptr;
+        MeowEngine::JobCounter* Counter = nullptr;
+    };
+
+    template<typename Function>
+    void Job::SetTask(Function&& inTask) {
+        using Task = std::decay_t<Function>;
+
+        if constexpr (sizeof(Task) <= InlineSize && alignof(Task) <= alignof(std::max_align_t)) {
+            ::new(static_cast<void*>(Storage)) Task(std::forward<Function>(inTask));
+
+            Invoke = [](void* inStorage) { (*static_cast<Task*>(inStorage))(); };
+            Destroy = [](void* inStorage) { static_cast<Task*>(inStorage)->~Task(); };
+        }
+        else {
+            // too big to keep inline, only the pointer is stored
+            ::new(static_cast<void*>(Storage)) Task*(new Task(std::forward<Function>(inTask)));
+
+            Invoke = [](void* inStorage) { (**static_cast<Task**>(inStorage))(); };
+            Destroy = [](void* inStorage) { delete *static_cast<Task**>(inStorage); };
+        }
+    }
+}
+
+#endif //MEOWENGINE_JOB_HPP
@@ -0,0 +1,247 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "job_system.hpp"
+#include "tracy_wrapper.hpp"
+
+namespace {
+    // lets Submit / Wait know if they are called from one of our workers
+    thread_local const MeowEngine::JobSystem* CurrentJobSystem = nullptr;
+    thread_local int CurrentWorkerIndex = -1;
+}
+
+MeowEngine::JobSystem::JobSystem(int inWorkerCount, std::function<void(int)> inOnWorkerStart)
+: OnWorkerStart(std::move(inOnWorkerStart))
+, IsRunning(true)
+, PendingJobCount(0)
+, SleepingWorkerCount(0) {
+    const int threadCount = std::max(inWorkerCount, 1) - 1;
+
+    // create all queues before any worker starts stealing
+    for(int i = 0; i < threadCount; i++) {
+        WorkerQueues.push_back(std::make_unique<MeowEngine::WorkStealingQueue<MeowEngine::Job*, QueueCapacity>>());
+    }
+
+    WorkerFreeJobLists.resize(threadCount);
+
+    for(int i = 0; i < threadCount; i++) {
+        Workers.emplace_back(&MeowEngine::JobSystem::WorkerLoop, this, i);
+    }
+}
+
+MeowEngine::JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(SleepMutex);
+        IsRunning = false;
+    }
+    SleepCondition.notify_all();
+
+    for(std::thread& worker : Workers) {
+        worker.join();
+    }
+
+    // every job comes from a block, so tasks left in worker deques, the shared queue
+    // or parked as continuations on counters that never finished are all found here
+    for(const std::unique_ptr<MeowEngine::Job[]>& block : JobBlocks) {
+        for(std::size_t i = 0; i < JobBlockSize; i++) {
+            block[i].ReleaseTask();
+        }
+    }
+}
+
+int MeowEngine::JobSystem::GetHardwareWorkerCount() {
+    const int coreCount = static_cast<int>(std::thread::hardware_concurrency());
+    return std::max(coreCount - 1, 1);
+}
+
+int MeowEngine::JobSystem::GetWorkerCount() const {
+    return static_cast<int>(Workers.size()) + 1;
+}
+
+void MeowEngine::JobSystem::Schedule(MeowEngine::Job* inJob, MeowEngine::JobCounter* inCounter, MeowEngine::JobCounter* inDependency) {
+    if(inCounter != nullptr) {
+        inCounter->Increment();
+    }
+
+    // held by dependency, gets queued once dependency is done
+    if(inDependency != nullptr && inDependency->TryAddContinuation(inJob)) {
+        return;
+    }
+
+    Enqueue(inJob);
+}
+
+MeowEngine::Job* MeowEngine::JobSystem::AcquireJob() {
+    const int workerIndex = GetCurrentWorkerIndex();
+    MeowEngine::Job* job;
+
+    if(workerIndex >= 0 && !WorkerFreeJobLists[workerIndex].Jobs.empty()) {
+        job = WorkerFreeJobLists[workerIndex].Jobs.back();
+        WorkerFreeJobLists[workerIndex].Jobs.pop_back();
+        return job;
+    }
+
+    if(SharedFreeJobs.try_dequeue(job)) {
+        return job;
+    }
+
+    MeowEngine::Job* block;
+    {
+        std::lock_guard<std::mutex> lock(JobBlockMutex);
+        block = JobBlocks.emplace_back(std::make_unique<MeowEngine::Job[]>(JobBlockSize)).get();
+    }
+
+    // first one is used now, rest goes where this thread looks first next time
+    if(workerIndex >= 0) {
+        for(std::size_t i = 1; i < JobBlockSize; i++) {
+            WorkerFreeJobLists[workerIndex].Jobs.push_back(&block[i]);
+        }
+    }
+    else {
+        std::vector<MeowEngine::Job*> jobs;
+        jobs.reserve(JobBlockSize - 1);
+        for(std::size_t i = 1; i < JobBlockSize; i++) {
+            jobs.push_back(&block[i]);
+        }
+        SharedFreeJobs.enqueue_bulk(jobs.begin(), jobs.size());
+    }
+
+    return &block[0];
+}
+
+void MeowEngine::JobSystem::ReleaseJob(MeowEngine::Job* inJob) {
+    inJob->ReleaseTask();
+    inJob->Counter = nullptr;
+
+    const int workerIndex = GetCurrentWorkerIndex();
+
+    // workers mostly finish jobs other threads submitted, overflow goes back to them through the shared list
+    if(workerIndex >= 0 && WorkerFreeJobLists[workerIndex].Jobs.size() < MaxWorkerFreeJobCount) {
+        WorkerFreeJobLists[workerIndex].Jobs.push_back(inJob);
+        return;
+    }
+
+    SharedFreeJobs.enqueue(inJob);
+}
+
+void MeowEngine::JobSystem::Wait(MeowEngine::JobCounter& inCounter) {
+    PT_PROFILE_SCOPE;
+    const int workerIndex = GetCurrentWorkerIndex();
+    int idleCount = 0;
+
+    while(!inCounter.IsDone()) {
+        MeowEngine::Job* job;
+        if(TryGetJob(workerIndex, job)) {
+            Execute(job);
+            idleCount = 0;
+        }
+        else if(++idleCount > SpinCountBeforeSleep) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void MeowEngine::JobSystem::WorkerLoop(int inWorkerIndex) {
+    CurrentJobSystem = this;
+    CurrentWorkerIndex = inWorkerIndex;
+
+    if(OnWorkerStart) {
+        OnWorkerStart(inWorkerIndex);
+    }
+
+    int idleCount = 0;
+
+    while(IsRunning.load(std::memory_order_relaxed)) {
+        MeowEngine::Job* job;
+        if(TryGetJob(inWorkerIndex, job)) {
+            Execute(job);
+            idleCount = 0;
+            continue;
+        }
+
+        // spin a little, new jobs usually arrive in bursts
+        if(++idleCount < SpinCountBeforeSleep) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        PT_PROFILE_SCOPE_N("Worker Sleeping");
+        std::unique_lock<std::mutex> lock(SleepMutex);
+        SleepingWorkerCount++;
+        SleepCondition.wait(lock, [this] {
+            return PendingJobCount.load() > 0 || !IsRunning;
+        });
+        SleepingWorkerCount--;
+        idleCount = 0;
+    }
+}
+
+int MeowEngine::JobSystem::GetCurrentWorkerIndex() const {
+    return CurrentJobSystem == this ? CurrentWorkerIndex : -1;
+}
+
+bool MeowEngine::JobSystem::TryGetJob(int inWorkerIndex, MeowEngine::Job*& outJob) {
+    bool isFound = false;
+
+    // own work first
+    if(inWorkerIndex >= 0) {
+        isFound = WorkerQueues[inWorkerIndex]->Pop(outJob);
+    }
+
+    if(!isFound) {
+        isFound = SharedQueue.try_dequeue(outJob);
+    }
+
+    // steal from others, start after ourselves so workers don't all hit the same victim
+    const int queueCount = static_cast<int>(WorkerQueues.size());
+    for(int i = 1; !isFound && i <= queueCount; i++) {
+        const int victim = (inWorkerIndex + i + queueCount) % queueCount;
+        if(victim != inWorkerIndex) {
+            isFound = WorkerQueues[victim]->Steal(outJob);
+        }
+    }
+
+    if(isFound) {
+        PendingJobCount.fetch_sub(1);
+    }
+
+    return isFound;
+}
+
+void MeowEngine::JobSystem::Execute(MeowEngine::Job* inJob) {
+    inJob->Run();
+
+    // task captures are gone before a waiter can see the counter done
+    MeowEngine::JobCounter* counter = inJob->Counter;
+    ReleaseJob(inJob);
+
+    std::vector<MeowEngine::Job*> continuations;
+    if(counter != nullptr && counter->Decrement(continuations)) {
+        for(MeowEngine::Job* continuation : continuations) {
+            Enqueue(continuation);
+        }
+    }
+}
+
+void MeowEngine::JobSystem::Enqueue(MeowEngine::Job* inJob) {
+    const int workerIndex = GetCurrentWorkerIndex();
+
+    if(workerIndex < 0 || !WorkerQueues[workerIndex]->Push(inJob)) {
+        SharedQueue.enqueue(inJob);
+    }
+
+    WakeWorkers(1);
+}
+
+void MeowEngine::JobSystem::WakeWorkers(int inJobCount) {
+    PendingJobCount.fetch_add(inJobCount);
+
+    // taking the lock makes sure a worker that is about to sleep sees the new job count
+    if(SleepingWorkerCount.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(SleepMutex);
+        }
+        SleepCondition.notify_one();
+    }
+}
@@ -0,0 +1,173 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_JOB_SYSTEM_HPP
+#define MEOWENGINE_JOB_SYSTEM_HPP
+
+#include "thread"
+#include "algorithm"
+#include "memory"
+#include "vector"
+#include "functional"
+#include "mutex"
+#include "condition_variable"
+#include "concurrentqueue.h"
+
+#include "job.hpp"
+#include "work_stealing_queue.hpp"
+
+namespace MeowEngine {
+    /**
+     * Work stealing job scheduler.
+     * Each worker owns a deque, jobs submitted from a worker go to its own deque and idle workers steal from others.
+     * Jobs submitted from outside threads (main / render) go to a shared queue.
+     * A thread calling Wait() keeps executing jobs until its counter is done, so it participates as a worker.
+     */
+    class JobSystem {
+    public:
+        /**
+         * @param inWorkerCount total participants including the thread calling Wait(), so (inWorkerCount - 1) threads are created
+         * @param inOnWorkerStart called on each worker thread before it takes any job, with its worker index (naming, affinity)
+         */
+        explicit JobSystem(int inWorkerCount, std::function<void(int)> inOnWorkerStart = nullptr);
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * Cores left after the main thread & dedicated render thread
+         */
+        static int GetHardwareWorkerCount();
+
+        int GetWorkerCount() const;
+
+        /**
+         * Queues a task. When a dependency is given, the task is only queued once the dependency is done.
+         * @param inTask
+         * @param inCounter incremented now & decremented when task finishes
+         * @param inDependency counter to wait for
+         */
+        template<typename Function>
+        void Submit(Function&& inTask, MeowEngine::JobCounter* inCounter = nullptr, MeowEngine::JobCounter* inDependency = nullptr);
+
+        /**
+         * Splits [0, inCount) into batches, inFunction(start, end) is called once per batch.
+         * Caller must wait on inCounter before anything captured by reference goes out of scope.
+         */
+        template<typename Function>
+        void ParallelFor(uint32_t inCount, uint32_t inBatchSize, Function&& inFunction, MeowEngine::JobCounter* inCounter, MeowEngine::JobCounter* inDependency = nullptr);
+
+        /**
+         * Parallel for over a single component entt view, inFunction(entity) is called per entity.
+         * Single component views are backed by a packed array, so we can split it into ranges.
+         */
+        template<typename View, typename Function>
+        void ParallelForEach(const View& inView, uint32_t inBatchSize, Function&& inFunction, MeowEngine::JobCounter* inCounter);
+
+        /**
+         * Blocks until counter is done, executing queued jobs in the meanwhile
+         */
+        void Wait(MeowEngine::JobCounter& inCounter);
+
+    private:
+        static constexpr std::size_t QueueCapacity = 4096;
+        static constexpr int SpinCountBeforeSleep = 64;
+        static constexpr std::size_t JobBlockSize = 256;
+        static constexpr std::size_t MaxWorkerFreeJobCount = 1024;
+
+        /**
+         * Free jobs of one worker, aligned so workers don't share cache lines
+         */
+        struct alignas(64) WorkerFreeJobs {
+            std::vector<MeowEngine::Job*> Jobs;
+        };
+
+        void WorkerLoop(int inWorkerIndex);
+
+        /**
+         * Takes a free job from the worker's own list, then from the shared one, and allocates a new block when both are empty
+         */
+        MeowEngine::Job* AcquireJob();
+        void ReleaseJob(MeowEngine::Job* inJob);
+        void Schedule(MeowEngine::Job* inJob, MeowEngine::JobCounter* inCounter, MeowEngine::JobCounter* inDependency);
+
+        int GetCurrentWorkerIndex() const;
+        bool TryGetJob(int inWorkerIndex, MeowEngine::Job*& outJob);
+        void Execute(MeowEngine::Job* inJob);
+        void Enqueue(MeowEngine::Job* inJob);
+        void WakeWorkers(int inJobCount);
+
+        std::function<void(int)> OnWorkerStart;
+        std::vector<std::thread> Workers;
+        std::vector<std::unique_ptr<MeowEngine::WorkStealingQueue<MeowEngine::Job*, QueueCapacity>>> WorkerQueues;
+
+        /**
+         * Jobs from non-worker threads or from workers with full deque
+         */
+        moodycamel::ConcurrentQueue<MeowEngine::Job*> SharedQueue;
+
+        /**
+         * Jobs are allocated in blocks & never freed before the system, finished jobs go back to a free list.
+         * Workers keep their own, non-worker threads & overflow go through the shared one.
+         */
+        std::vector<WorkerFreeJobs> WorkerFreeJobLists;
+        moodycamel::ConcurrentQueue<MeowEngine::Job*> SharedFreeJobs;
+        std::mutex JobBlockMutex;
+        std::vector<std::unique_ptr<MeowEngine::Job[]>> JobBlocks;
+
+        std::atomic<bool> IsRunning;
+        std::atomic<int> PendingJobCount;
+        std::atomic<int> SleepingWorkerCount;
+        std::mutex SleepMutex;
+        std::condition_variable SleepCondition;
+    };
+
+    template<typename Function>
+    void JobSystem::Submit(Function&& inTask, MeowEngine::JobCounter* inCounter, MeowEngine::JobCounter* inDependency) {
+        MeowEngine::Job* job = AcquireJob();
+        job->SetTask(std::forward<Function>(inTask));
+        job->Counter = inCounter;
+
+        Schedule(job, inCounter, inDependency);
+    }
+
+    template<typename Function>
+    void JobSystem::ParallelFor(uint32_t inCount, uint32_t inBatchSize, Function&& inFunction, MeowEngine::JobCounter* inCounter, MeowEngine::JobCounter* inDependency) {
+        if(inCount == 0) {
+            return;
+        }
+
+        const uint32_t batchSize = inBatchSize > 0 ? inBatchSize : 1;
+
+        // shared between batches so the function is copied once
+        auto function = std::make_shared<std::decay_t<Function>>(std::forward<Function>(inFunction));
+
+        for(uint32_t start = 0; start < inCount; start += batchSize) {
+            const uint32_t end = std::min(start + batchSize, inCount);
+
+            Submit([function, start, end]() {
+                (*function)(start, end);
+            }, inCounter, inDependency);
+        }
+    }
+
+    template<typename View, typename Function>
+    void JobSystem::ParallelForEach(const View& inView, uint32_t inBatchSize, Function&& inFunction, MeowEngine::JobCounter* inCounter) {
+        auto begin = inView.begin();
+
+        ParallelFor(
+            static_cast<uint32_t>(inView.size()),
+            inBatchSize,
+            [begin, function = std::forward<Function>(inFunction)](uint32_t inStart, uint32_t inEnd) {
+                for(uint32_t index = inStart; index < inEnd; index++) {
+                    function(*(begin + index));
+                }
+            },
+            inCounter
+        );
+    }
+}
+
+#endif //MEOWENGINE_JOB_SYSTEM_HPP
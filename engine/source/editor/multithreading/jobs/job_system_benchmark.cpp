@@ -0,0 +1,54 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "job_system_benchmark.hpp"
+#include "job_system.hpp"
+#include "main_scene.hpp"
+#include "log.hpp"
+
+#include "chrono"
+#include "algorithm"
+#include "iomanip"
+#include "sstream"
+
+void MeowEngine::JobSystemBenchmark::RunScalingBenchmark(uint32_t inEntityCount, int inFrameCount) {
+    const int workerCounts[] = {1, 2, 4, 8, 16};
+    const float deltaTime = 1.0f / 60.0f;
+
+    // cubes are spawned in 100 x 100 layers, like the shift + right click grid
+    constexpr int layerSize = 100;
+    const int layerCount = std::max(1, static_cast<int>((inEntityCount + layerSize * layerSize - 1) / (layerSize * layerSize)));
+
+    MeowEngine::Log("Job System Benchmark", std::to_string(layerSize * layerSize * layerCount) + " entities, "
+                    + std::to_string(inFrameCount) + " frames, "
+                    + std::to_string(std::thread::hardware_concurrency()) + " hardware threads");
+
+    // grid is built once, only the scheduler changes between runs
+    MeowEngine::MainScene scene({1280, 720}, std::make_shared<MeowEngine::JobSystem>(1));
+    scene.SpawnCubeGridOnMainThread(layerSize, layerCount, layerSize);
+
+    double singleWorkerFrameTime = 0.0;
+
+    for(const int workerCount : workerCounts) {
+        scene.SetJobSystem(std::make_shared<MeowEngine::JobSystem>(workerCount));
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        for(int frame = 0; frame < inFrameCount; frame++) {
+            scene.Update(deltaTime);
+        }
+
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - startTime;
+        const double frameTime = elapsed.count() / inFrameCount;
+
+        if(workerCount == 1) {
+            singleWorkerFrameTime = frameTime;
+        }
+
+        std::ostringstream result;
+        result << std::fixed << std::setprecision(3) << workerCount << " workers, " << frameTime << " ms/frame, "
+               << std::setprecision(2) << singleWorkerFrameTime / frameTime << "x speed up";
+        MeowEngine::Log("Job System Benchmark", result.str());
+    }
+}
@@ -0,0 +1,21 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_JOB_SYSTEM_BENCHMARK_HPP
+#define MEOWENGINE_JOB_SYSTEM_BENCHMARK_HPP
+
+#include "cstdint"
+
+namespace MeowEngine {
+    struct JobSystemBenchmark {
+        /**
+         * Runs MainScene::Update on a spawned cube grid with 1, 2, 4, 8 & 16 workers
+         * and logs average frame time & speed up against single worker.
+         * No window / GL context is created, so can be run on build agents.
+         */
+        static void RunScalingBenchmark(uint32_t inEntityCount = 200000, int inFrameCount = 100);
+    };
+}
+
+#endif //MEOWENGINE_JOB_SYSTEM_BENCHMARK_HPP
@@ -0,0 +1,111 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_WORK_STEALING_QUEUE_HPP
+#define MEOWENGINE_WORK_STEALING_QUEUE_HPP
+
+#include "atomic"
+#include "array"
+#include "cstdint"
+#include "cstddef"
+
+namespace MeowEngine {
+    /**
+     * Fixed capacity Chase-Lev deque.
+     * Only the owning worker pushes / pops from the bottom, any other worker can steal from the top.
+     * (Le, Pop, Cohen & Nardelli - "Correct and Efficient Work-Stealing for Weak Memory Models")
+     * @tparam Type pointer / trivially copyable item
+     * @tparam Capacity must be power of 2
+     */
+    template<typename Type, std::size_t Capacity>
+    class WorkStealingQueue {
+        static_assert((Capacity & (Capacity - 1)) == 0, "WorkStealingQueue capacity must be power of 2");
+
+    public:
+        WorkStealingQueue()
+        : Top(0)
+        , Bottom(0) {}
+
+        /**
+         * Owner only. Returns false when full, caller should fallback to a shared queue.
+         */
+        bool Push(Type inItem) {
+            const int64_t bottom = Bottom.load(std::memory_order_relaxed);
+            const int64_t top = Top.load(std::memory_order_acquire);
+
+            if(bottom - top >= static_cast<int64_t>(Capacity)) {
+                return false;
+            }
+
+            Items[bottom & Mask].store(inItem, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            Bottom.store(bottom + 1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        /**
+         * Owner only. Takes the most recently pushed item (LIFO keeps caches warm).
+         */
+        bool Pop(Type& outItem) {
+            const int64_t bottom = Bottom.load(std::memory_order_relaxed) - 1;
+            Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = Top.load(std::memory_order_relaxed);
+
+            if(top > bottom) {
+                // queue was empty
+                Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            outItem = Items[bottom & Mask].load(std::memory_order_relaxed);
+
+            if(top == bottom) {
+                // last item, race against thieves for it
+                const bool isWon = Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return isWon;
+            }
+
+            return true;
+        }
+
+        /**
+         * Any thread. Takes the oldest item (FIFO), fails if empty or lost race.
+         */
+        bool Steal(Type& outItem) {
+            int64_t top = Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = Bottom.load(std::memory_order_acquire);
+
+            if(top >= bottom) {
+                return false;
+            }
+
+            Type item = Items[top & Mask].load(std::memory_order_relaxed);
+            if(!Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return false;
+            }
+
+            outItem = item;
+            return true;
+        }
+
+        std::size_t SizeApprox() const {
+            const int64_t size = Bottom.load(std::memory_order_relaxed) - Top.load(std::memory_order_relaxed);
+            return size > 0 ? static_cast<std::size_t>(size) : 0;
+        }
+
+    private:
+        static constexpr int64_t Mask = static_cast<int64_t>(Capacity) - 1;
+
+        // keep owner & thieves end on separate cache lines
+        alignas(64) std::atomic<int64_t> Top;
+        alignas(64) std::atomic<int64_t> Bottom;
+        alignas(64) std::array<std::atomic<Type>, Capacity> Items;
+    };
+}
+
+#endif //MEOWENGINE_WORK_STEALING_QUEUE_HPP
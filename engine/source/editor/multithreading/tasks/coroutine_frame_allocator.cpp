@@ -0,0 +1,58 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "coroutine_frame_allocator.hpp"
+#include "concurrentqueue.h"
+
+#include <array>
+#include <new>
+
+namespace {
+    constexpr std::size_t SmallestClassSize = 64;
+    constexpr std::size_t ClassCount = 8; // 64 B - 8 KB
+
+    std::size_t GetSizeClass(std::size_t inSize) {
+        std::size_t sizeClass = 0;
+        std::size_t classSize = SmallestClassSize;
+
+        while(classSize < inSize) {
+            classSize <<= 1;
+            sizeClass++;
+        }
+
+        return sizeClass;
+    }
+
+    std::array<moodycamel::ConcurrentQueue<void*>, ClassCount>& GetFreeLists() {
+        // leaked on purpose, frames can still be freed while static destructors run
+        static auto* freeLists = new std::array<moodycamel::ConcurrentQueue<void*>, ClassCount>();
+        return *freeLists;
+    }
+}
+
+void* MeowEngine::CoroutineFrameAllocator::Allocate(std::size_t inSize) {
+    const std::size_t sizeClass = ::GetSizeClass(inSize);
+
+    if(sizeClass >= ClassCount) {
+        return ::operator new(inSize);
+    }
+
+    void* frame;
+    if(::GetFreeLists()[sizeClass].try_dequeue(frame)) {
+        return frame;
+    }
+
+    return ::operator new(SmallestClassSize << sizeClass);
+}
+
+void MeowEngine::CoroutineFrameAllocator::Free(void* inFrame, std::size_t inSize) {
+    const std::size_t sizeClass = ::GetSizeClass(inSize);
+
+    if(sizeClass >= ClassCount) {
+        ::operator delete(inFrame);
+        return;
+    }
+
+    ::GetFreeLists()[sizeClass].enqueue(inFrame);
+}
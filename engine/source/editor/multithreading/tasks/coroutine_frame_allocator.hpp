@@ -0,0 +1,23 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_COROUTINE_FRAME_ALLOCATOR_HPP
+#define MEOWENGINE_COROUTINE_FRAME_ALLOCATOR_HPP
+
+#include "cstddef"
+
+namespace MeowEngine {
+    /**
+     * Pools coroutine frames by power of 2 size class, so starting a task doesn't hit the heap once pools are warm.
+     * Frames usually finish on a different thread than they started on, so free lists are shared & lock free.
+     * Frames larger than the biggest class go to the heap.
+     */
+    class CoroutineFrameAllocator {
+    public:
+        static void* Allocate(std::size_t inSize);
+        static void Free(void* inFrame, std::size_t inSize);
+    };
+}
+
+#endif //MEOWENGINE_COROUTINE_FRAME_ALLOCATOR_HPP
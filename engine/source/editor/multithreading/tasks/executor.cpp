@@ -0,0 +1,44 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "executor.hpp"
+#include "tracy_wrapper.hpp"
+
+MeowEngine::QueueExecutor::QueueExecutor(const char* inName)
+: Name(inName) {}
+
+MeowEngine::QueueExecutor::~QueueExecutor() {
+    // owner is gone, coroutines still parked here will never resume so release their frames
+    std::coroutine_handle<> handle;
+    while(Pending.try_dequeue(handle)) {
+        handle.destroy();
+    }
+}
+
+void MeowEngine::QueueExecutor::Post(std::coroutine_handle<> inHandle) {
+    Pending.enqueue(inHandle);
+}
+
+int MeowEngine::QueueExecutor::RunPending() {
+    PT_PROFILE_SCOPE;
+    int pendingCount = static_cast<int>(Pending.size_approx());
+    int resumedCount = 0;
+
+    std::coroutine_handle<> handle;
+    while(resumedCount < pendingCount && Pending.try_dequeue(handle)) {
+        handle.resume();
+        resumedCount++;
+    }
+
+    return resumedCount;
+}
+
+MeowEngine::JobExecutor::JobExecutor(std::shared_ptr<MeowEngine::JobSystem> inJobSystem)
+: Jobs(std::move(inJobSystem)) {}
+
+void MeowEngine::JobExecutor::Post(std::coroutine_handle<> inHandle) {
+    Jobs->Submit([inHandle] {
+        inHandle.resume();
+    });
+}
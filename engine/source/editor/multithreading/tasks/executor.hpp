@@ -0,0 +1,65 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_EXECUTOR_HPP
+#define MEOWENGINE_EXECUTOR_HPP
+
+#include "coroutine"
+#include "memory"
+#include "concurrentqueue.h"
+
+#include "job_system.hpp"
+
+namespace MeowEngine {
+    /**
+     * Somewhere a suspended coroutine can be resumed
+     */
+    class Executor {
+    public:
+        virtual ~Executor() = default;
+
+        virtual void Post(std::coroutine_handle<> inHandle) = 0;
+    };
+
+    /**
+     * Resumes coroutines on the thread that owns it (main, render, physics frame) when that thread calls RunPending
+     */
+    class QueueExecutor : public Executor {
+    public:
+        explicit QueueExecutor(const char* inName);
+        ~QueueExecutor() override;
+
+        void Post(std::coroutine_handle<> inHandle) override;
+
+        /**
+         * Resumes everything posted before the call. Anything posted while resuming waits for next call,
+         * so a coroutine posting back to the same executor can't keep the owner busy forever.
+         * @return resumed count
+         */
+        int RunPending();
+
+        const char* GetName() const {
+            return Name;
+        }
+
+    private:
+        const char* Name;
+        moodycamel::ConcurrentQueue<std::coroutine_handle<>> Pending;
+    };
+
+    /**
+     * Resumes coroutines on job system workers
+     */
+    class JobExecutor : public Executor {
+    public:
+        explicit JobExecutor(std::shared_ptr<MeowEngine::JobSystem> inJobSystem);
+
+        void Post(std::coroutine_handle<> inHandle) override;
+
+    private:
+        std::shared_ptr<MeowEngine::JobSystem> Jobs;
+    };
+}
+
+#endif //MEOWENGINE_EXECUTOR_HPP
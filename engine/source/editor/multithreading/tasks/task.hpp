@@ -0,0 +1,81 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_TASK_HPP
+#define MEOWENGINE_TASK_HPP
+
+#include "coroutine"
+#include "exception"
+#include "cstddef"
+
+#include "executor.hpp"
+#include "coroutine_frame_allocator.hpp"
+
+namespace MeowEngine {
+    /**
+     * Fire & forget coroutine. Starts right away on the calling thread, hops threads with co_await ResumeOn(executor)
+     * and releases its frame when it finishes. Frames come from CoroutineFrameAllocator.
+     *
+     *      MeowEngine::Task LoadMesh(...) {
+     *          co_await MeowEngine::ResumeOn(WorkerExecutor);   // parse file
+     *          co_await MeowEngine::ResumeOn(RenderExecutor);   // gl upload
+     *          co_await MeowEngine::ResumeOn(MainExecutor);     // attach components
+     *      }
+     *
+     * Anything a task touches after a hop has to outlive the task, pass values rather than references.
+     */
+    struct Task {
+        struct promise_type {
+            Task get_return_object() noexcept {
+                return {};
+            }
+
+            std::suspend_never initial_suspend() noexcept {
+                return {};
+            }
+
+            std::suspend_never final_suspend() noexcept {
+                return {};
+            }
+
+            void return_void() noexcept {}
+
+            void unhandled_exception() noexcept {
+                // nobody is awaiting a detached task, so there is no one to rethrow to
+                std::terminate();
+            }
+
+            static void* operator new(std::size_t inSize) {
+                return MeowEngine::CoroutineFrameAllocator::Allocate(inSize);
+            }
+
+            static void operator delete(void* inFrame, std::size_t inSize) {
+                MeowEngine::CoroutineFrameAllocator::Free(inFrame, inSize);
+            }
+        };
+    };
+
+    struct ResumeOnAwaiter {
+        MeowEngine::Executor& Target;
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> inHandle) {
+            Target.Post(inHandle);
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * Suspends the task & continues it on the given executor
+     */
+    inline ResumeOnAwaiter ResumeOn(MeowEngine::Executor& inExecutor) {
+        return {inExecutor};
+    }
+}
+
+#endif //MEOWENGINE_TASK_HPP
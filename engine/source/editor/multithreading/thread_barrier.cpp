@@ -1,5 +0,0 @@
-//
-// Created by Akira Mujawar on 27/10/24.
-//
-
-#include "thread_barrier.hpp"
@@ -0,0 +1,295 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "thread_configuration.hpp"
+#include "tracy_wrapper.hpp"
+#include "log.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <climits>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#include <sys/qos.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+namespace {
+    bool IsNumber(const std::string& inValue) {
+        return !inValue.empty() && std::all_of(inValue.begin(), inValue.end(), [](char inCharacter) { return inCharacter >= '0' && inCharacter <= '9'; });
+    }
+
+    /**
+     * Cores past this can't be pinned, either the machine doesn't have them or the affinity mask can't hold them
+     */
+    int GetCoreLimit() {
+#if defined(__linux__)
+        constexpr int maskLimit = CPU_SETSIZE;
+#elif defined(_WIN32)
+        constexpr int maskLimit = static_cast<int>(sizeof(DWORD_PTR) * 8);
+#else
+        constexpr int maskLimit = INT_MAX;
+#endif
+        const int hardwareCount = static_cast<int>(std::thread::hardware_concurrency());
+
+        // 0 when the count isn't known, only the mask size applies then
+        return hardwareCount > 0 ? std::min(hardwareCount, maskLimit) : maskLimit;
+    }
+
+    /**
+     * Digits are added one by one, so long inputs are rejected before they overflow
+     */
+    bool TryParseCore(const std::string& inValue, int inCoreLimit, int& outCore) {
+        if(!IsNumber(inValue)) {
+            return false;
+        }
+
+        int core = 0;
+        for(const char character : inValue) {
+            core = core * 10 + (character - '0');
+
+            if(core >= inCoreLimit) {
+                MeowEngine::Log("Thread Configuration", "Core " + inValue + " is out of range, cores go up to " + std::to_string(inCoreLimit - 1));
+                return false;
+            }
+        }
+
+        outCore = core;
+        return true;
+    }
+
+    bool TryParseCores(const std::string& inValue, std::vector<int>& outCores) {
+        const int coreLimit = GetCoreLimit();
+        std::vector<int> cores;
+        std::stringstream stream(inValue);
+        std::string range;
+
+        while(std::getline(stream, range, ',')) {
+            const size_t dash = range.find('-');
+            const std::string firstText = range.substr(0, dash);
+            const std::string lastText = dash == std::string::npos ? firstText : range.substr(dash + 1);
+
+            int first;
+            int last;
+            if(!TryParseCore(firstText, coreLimit, first) || !TryParseCore(lastText, coreLimit, last)) {
+                return false;
+            }
+
+            if(last < first) {
+                return false;
+            }
+
+            for(int core = first; core <= last; core++) {
+                cores.push_back(core);
+            }
+        }
+
+        outCores = cores;
+        return !outCores.empty();
+    }
+
+    bool TryParsePriority(const std::string& inValue, MeowEngine::ThreadPriority& outPriority) {
+        if(inValue == "low") {
+            outPriority = MeowEngine::ThreadPriority::Low;
+        }
+        else if(inValue == "normal") {
+            outPriority = MeowEngine::ThreadPriority::Normal;
+        }
+        else if(inValue == "high") {
+            outPriority = MeowEngine::ThreadPriority::High;
+        }
+        else if(inValue == "realtime") {
+            outPriority = MeowEngine::ThreadPriority::Realtime;
+        }
+        else {
+            return false;
+        }
+
+        return true;
+    }
+
+    void SetCurrentThreadName(const std::string& inThreadName) {
+        PT_PROFILE_THREAD_NAME(inThreadName.c_str());
+
+#if defined(__linux__)
+        // linux caps thread names at 15 characters
+        pthread_setname_np(pthread_self(), inThreadName.substr(0, 15).c_str());
+#elif defined(__APPLE__)
+        pthread_setname_np(inThreadName.c_str());
+#endif
+    }
+
+    bool SetCurrentThreadAffinity(const std::vector<int>& inCores) {
+#if defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for(const int core : inCores) {
+            CPU_SET(core, &cpuSet);
+        }
+
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) == 0;
+#elif defined(_WIN32)
+        DWORD_PTR mask = 0;
+        for(const int core : inCores) {
+            mask |= static_cast<DWORD_PTR>(1) << core;
+        }
+
+        return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#else
+        // macOS only takes affinity hints & emscripten has no say over threads
+        return false;
+#endif
+    }
+
+    bool SetCurrentThreadPriority(MeowEngine::ThreadPriority inPriority) {
+#if defined(__linux__)
+        if(inPriority == MeowEngine::ThreadPriority::Realtime) {
+            sched_param parameter{};
+            parameter.sched_priority = sched_get_priority_min(SCHED_FIFO) + 10;
+            return pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameter) == 0;
+        }
+
+        // SCHED_OTHER threads only differ by nice value, which linux keeps per thread
+        const int niceValue = inPriority == MeowEngine::ThreadPriority::Low ? 10 : inPriority == MeowEngine::ThreadPriority::High ? -5 : 0;
+        return setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), niceValue) == 0;
+#elif defined(__APPLE__)
+        qos_class_t qosClass = QOS_CLASS_DEFAULT;
+        switch (inPriority) {
+            case MeowEngine::ThreadPriority::Low:
+                qosClass = QOS_CLASS_UTILITY;
+                break;
+            case MeowEngine::ThreadPriority::Normal:
+                qosClass = QOS_CLASS_DEFAULT;
+                break;
+            case MeowEngine::ThreadPriority::High:
+                qosClass = QOS_CLASS_USER_INITIATED;
+                break;
+            case MeowEngine::ThreadPriority::Realtime:
+                qosClass = QOS_CLASS_USER_INTERACTIVE;
+                break;
+        }
+
+        return pthread_set_qos_class_self_np(qosClass, 0) == 0;
+#elif defined(_WIN32)
+        int priority = THREAD_PRIORITY_NORMAL;
+        switch (inPriority) {
+            case MeowEngine::ThreadPriority::Low:
+                priority = THREAD_PRIORITY_BELOW_NORMAL;
+                break;
+            case MeowEngine::ThreadPriority::Normal:
+                priority = THREAD_PRIORITY_NORMAL;
+                break;
+            case MeowEngine::ThreadPriority::High:
+                priority = THREAD_PRIORITY_ABOVE_NORMAL;
+                break;
+            case MeowEngine::ThreadPriority::Realtime:
+                priority = THREAD_PRIORITY_TIME_CRITICAL;
+                break;
+        }
+
+        return SetThreadPriority(GetCurrentThread(), priority) != 0;
+#else
+        return false;
+#endif
+    }
+}
+
+bool MeowEngine::ThreadConfiguration::LoadFile(const std::string& inFilePath) {
+    std::ifstream file(inFilePath);
+
+    if(!file.is_open()) {
+        MeowEngine::Log("Thread Configuration", "Could not open " + inFilePath);
+        return false;
+    }
+
+    bool isValid = true;
+    std::string line;
+
+    while(std::getline(file, line)) {
+        line = line.substr(0, line.find('#'));
+
+        if(line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+
+        isValid &= ParseEntry(line);
+    }
+
+    return isValid;
+}
+
+bool MeowEngine::ThreadConfiguration::ParseEntry(const std::string& inEntry) {
+    std::string entry = inEntry;
+    std::replace(entry.begin(), entry.end(), ':', ' ');
+
+    std::stringstream stream(entry);
+    std::string role;
+    stream >> role;
+
+    if(role.empty()) {
+        return false;
+    }
+
+    ThreadSettings settings = Settings[role];
+    std::string token;
+
+    while(stream >> token) {
+        const size_t equals = token.find('=');
+        const std::string key = token.substr(0, equals);
+        const std::string value = equals == std::string::npos ? "" : token.substr(equals + 1);
+
+        if(key == "cores" && TryParseCores(value, settings.Cores)) {
+            continue;
+        }
+
+        if(key == "priority" && TryParsePriority(value, settings.Priority)) {
+            continue;
+        }
+
+        MeowEngine::Log("Thread Configuration", "Invalid setting " + token + " for " + role);
+        return false;
+    }
+
+    Settings[role] = settings;
+    return true;
+}
+
+const MeowEngine::ThreadSettings* MeowEngine::ThreadConfiguration::Find(const std::string& inRole) const {
+    const auto iterator = Settings.find(inRole);
+    return iterator == Settings.end() ? nullptr : &iterator->second;
+}
+
+void MeowEngine::ThreadConfiguration::ApplyToCurrentThread(const std::string& inRole, const std::string& inThreadName, int inIndex) const {
+    SetCurrentThreadName(inThreadName);
+
+    const ThreadSettings* settings = Find(inRole);
+
+    if(settings == nullptr) {
+        return;
+    }
+
+    if(!settings->Cores.empty()) {
+        const std::vector<int> cores = inIndex < 0
+            ? settings->Cores
+            : std::vector<int>{settings->Cores[inIndex % settings->Cores.size()]};
+
+        if(!SetCurrentThreadAffinity(cores)) {
+            MeowEngine::Log("Thread Configuration", "Could not set affinity for " + inThreadName);
+        }
+    }
+
+    if(settings->Priority != ThreadPriority::Normal && !SetCurrentThreadPriority(settings->Priority)) {
+        MeowEngine::Log("Thread Configuration", "Could not set priority for " + inThreadName);
+    }
+}
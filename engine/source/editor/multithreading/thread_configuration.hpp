@@ -0,0 +1,56 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_THREAD_CONFIGURATION_HPP
+#define MEOWENGINE_THREAD_CONFIGURATION_HPP
+
+#include "string"
+#include "vector"
+#include "unordered_map"
+
+namespace MeowEngine {
+    enum class ThreadPriority {
+        Low,
+        Normal,
+        High,
+        Realtime
+    };
+
+    struct ThreadSettings {
+        // empty lets os schedule the thread anywhere
+        std::vector<int> Cores;
+        ThreadPriority Priority = ThreadPriority::Normal;
+    };
+
+    /**
+     * Core affinity & priority per thread role (main, render, worker), read from a file and / or command line.
+     * One entry per role, later entries for same role override earlier ones:
+     *      <role> [cores=<list>] [priority=low|normal|high|realtime]
+     *      i.e. "worker cores=2-7 priority=high", core list takes ranges & commas "0,2,4-5"
+     * Cores the machine doesn't have are rejected like any other invalid setting.
+     * In a file entries are one per line & '#' starts a comment, on command line ':' can be used instead of spaces.
+     */
+    class ThreadConfiguration {
+    public:
+        bool LoadFile(const std::string& inFilePath);
+        bool ParseEntry(const std::string& inEntry);
+
+        const ThreadSettings* Find(const std::string& inRole) const;
+
+        /**
+         * Names calling thread for os & tracy, then applies its role's affinity & priority.
+         * Unsupported / denied settings are logged and skipped, thread keeps running with os defaults.
+         * @param inRole
+         * @param inThreadName shown in profiler / debugger
+         * @param inIndex for pools, picks a single core from role's list (round robin) so workers don't migrate.
+         *                -1 pins to whole list
+         */
+        void ApplyToCurrentThread(const std::string& inRole, const std::string& inThreadName, int inIndex = -1) const;
+
+    private:
+        std::unordered_map<std::string, ThreadSettings> Settings;
+    };
+}
+
+#endif //MEOWENGINE_THREAD_CONFIGURATION_HPP
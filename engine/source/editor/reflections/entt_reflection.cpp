@@ -6,56 +6,212 @@
 
 #include "log.hpp"
 
-bool MeowEngine::EnttReflection::HasComponent(entt::id_type inId) {
-    return Components.find(inId) != Components.end();
+#include <algorithm>
+
+namespace {
+    constexpr uint64_t PathHashSeed = 0xcbf29ce484222325ull;
+
+    /**
+     * FNV-1a of the segment with a '.' in front of it, so hashes follow "Component.Property.Leaf"
+     */
+    uint64_t HashPathSegment(std::string_view inSegment, uint64_t inHash) {
+        if(inHash != PathHashSeed) {
+            inHash ^= static_cast<uint8_t>('.');
+            inHash *= 0x100000001b3ull;
+        }
+
+        for(char character : inSegment) {
+            inHash ^= static_cast<uint8_t>(character);
+            inHash *= 0x100000001b3ull;
+        }
+
+        return inHash;
+    }
 }
 
-bool MeowEngine::EnttReflection::HasProperty(std::string inPropertyName) {
-    return Properties.find(inPropertyName) != Properties.end();
+bool MeowEngine::EnttReflection::HasComponent(entt::id_type inId) const {
+    const ReflectionType* type = FindType(inId);
+    return type != nullptr && type->IsComponent;
 }
 
-std::string MeowEngine::EnttReflection::GetComponentName(entt::id_type inId) {
-    return Components[inId];
+bool MeowEngine::EnttReflection::HasType(entt::id_type inId) const {
+    return FindType(inId) != nullptr;
 }
 
-std::vector<MeowEngine::ReflectionProperty> MeowEngine::EnttReflection::GetProperties(std::string inClassName) {
-    return Properties[inClassName];
+const std::string& MeowEngine::EnttReflection::GetComponentName(entt::id_type inId) const {
+    static const std::string unknownName;
+
+    const ReflectionType* type = FindType(inId);
+    return type != nullptr ? type->Name : unknownName;
 }
 
-void MeowEngine::EnttReflection::RegisterComponent(entt::id_type inId, std::string inName) {
-    if(!HasComponent(inId)) {
-//        Components.insert_or_assign(inId, inName);
-        Components[inId] = inName;
+std::span<const MeowEngine::ReflectionProperty> MeowEngine::EnttReflection::GetProperties(entt::id_type inTypeId) const {
+    const ReflectionType* type = FindType(inTypeId);
+    if(type == nullptr) {
+        return {};
     }
+
+    return type->Properties;
 }
 
-void MeowEngine::EnttReflection::RegisterProperty(std::string inClassName, ReflectionProperty inProperty) {
-//    if(!HasProperty(inClassName)) {
-        Properties[inClassName].push_back(inProperty);
-//    }
+uint32_t MeowEngine::EnttReflection::FindPropertyIndex(entt::id_type inTypeId, std::string_view inPropertyName) const {
+    for(const ReflectionProperty& property : GetProperties(inTypeId)) {
+        if(property.Name == inPropertyName) {
+            return property.Index;
+        }
+    }
+
+    return NoProperty;
 }
 
-void MeowEngine::EnttReflection::ApplyPropertyChange(MeowEngine::ReflectionPropertyChange& inPropertyChange, entt::registry& inRegistry) {
-    auto changedEntity = static_cast<entt::entity>(inPropertyChange.EntityId);
+void MeowEngine::EnttReflection::RegisterComponent(entt::id_type inId, std::string inName) {
+    GetOrAddType(inId, std::move(inName)).IsComponent = true;
+}
 
-    entt::basic_registry<>::common_type *componentStorage = inRegistry.storage(inPropertyChange.ComponentType);
-    std::string componentName = GetComponentName(inPropertyChange.ComponentType);
+void MeowEngine::EnttReflection::RegisterProperty(entt::id_type inClassId, std::string inClassName, ReflectionProperty inProperty) {
+    if(FindPropertyIndex(inClassId, inProperty.Name) != NoProperty) {
+        return;
+    }
 
-    void *classObject = componentStorage->value(changedEntity);
+    ReflectionType& type = GetOrAddType(inClassId, std::move(inClassName));
+    inProperty.Index = static_cast<uint32_t>(type.Properties.size());
+    type.Properties.push_back(std::move(inProperty));
+}
 
-    // if component has direct changes
-    if(inPropertyChange.ClassProperties.empty()) {
-        ApplyPropertyChangeData(componentName, inPropertyChange, classObject);
+uint32_t MeowEngine::EnttReflection::InternPropertyPath(entt::id_type inComponentType, std::span<const uint32_t> inPropertyIndices) {
+    if(inPropertyIndices.empty() || inPropertyIndices.size() > ReflectionPropertyChange::MaxPathDepth) {
+        return ReflectionPropertyChange::NoPath;
     }
-    // if classes / struct within component has changes
-    else {
-        for(int i = inPropertyChange.ClassProperties.size() - 1; i >= 0; i--) {
-            MeowEngine::ReflectionProperty property = inPropertyChange.ClassProperties[i];
-            classObject = property.Get(classObject);
 
-            if(i == 0) {
-                ApplyPropertyChangeData(property.TypeName, inPropertyChange, classObject);
-            }
+    // resolve, walking names is fine here since it only happens when a path is referenced
+    ReflectionPropertyPath path{};
+    path.ComponentType = inComponentType;
+    path.Hash = ::HashPathSegment(GetComponentName(inComponentType), ::PathHashSeed);
+    path.Depth = static_cast<uint32_t>(inPropertyIndices.size());
+
+    entt::id_type classId = inComponentType;
+    for(uint32_t i = 0; i < path.Depth; i++) {
+        std::span<const ReflectionProperty> properties = GetProperties(classId);
+        if(inPropertyIndices[i] >= properties.size()) {
+            return ReflectionPropertyChange::NoPath;
+        }
+
+        const ReflectionProperty& property = properties[inPropertyIndices[i]];
+        path.Hash = ::HashPathSegment(property.Name, path.Hash);
+        path.Offset += property.Offset;
+        path.Size = property.Size;
+        path.IsTriviallyCopyable = property.IsTriviallyCopyable;
+        path.Assign = property.Assign;
+        path.PropertyIndices[i] = inPropertyIndices[i];
+
+        classId = property.TypeHash;
+    }
+
+    std::lock_guard<std::mutex> lock(PathMutex);
+
+    const uint32_t pathCount = PathCount.load(std::memory_order_relaxed);
+    if(auto pathId = PathIds.find(path.Hash); pathId != PathIds.end()) {
+        const ReflectionPropertyPath& internedPath = Paths[pathId->second];
+
+        // 64 bit collisions shouldn't happen, but a wrong path would silently write the wrong member
+        if(internedPath.ComponentType != inComponentType || internedPath.Depth != path.Depth
+           || !std::equal(inPropertyIndices.begin(), inPropertyIndices.end(), internedPath.PropertyIndices.begin())) {
+            MeowEngine::Log("Reflection", "Property path hash collision");
+            return ReflectionPropertyChange::NoPath;
+        }
+
+        return pathId->second;
+    }
+
+    if(pathCount == MaxPropertyPaths) {
+        MeowEngine::Log("Reflection", "Property path table is full");
+        return ReflectionPropertyChange::NoPath;
+    }
+
+    Paths[pathCount] = path;
+    PathIds.emplace(path.Hash, pathCount);
+
+    // publish after the path is written, readers only look at ids below the count
+    PathCount.store(pathCount + 1, std::memory_order_release);
+
+    return pathCount;
+}
+
+uint32_t MeowEngine::EnttReflection::InternPropertyPath(entt::id_type inComponentType, std::string_view inPropertyPath) {
+    std::array<uint32_t, ReflectionPropertyChange::MaxPathDepth> propertyIndices;
+    std::size_t depth = 0;
+
+    entt::id_type classId = inComponentType;
+    while(!inPropertyPath.empty()) {
+        const std::size_t separator = inPropertyPath.find('.');
+        const std::string_view propertyName = inPropertyPath.substr(0, separator);
+
+        const uint32_t propertyIndex = FindPropertyIndex(classId, propertyName);
+        if(propertyIndex == NoProperty || depth == propertyIndices.size()) {
+            return ReflectionPropertyChange::NoPath;
         }
+
+        propertyIndices[depth++] = propertyIndex;
+        classId = GetProperties(classId)[propertyIndex].TypeHash;
+
+        inPropertyPath = separator == std::string_view::npos ? std::string_view() : inPropertyPath.substr(separator + 1);
+    }
+
+    return InternPropertyPath(inComponentType, {propertyIndices.data(), depth});
+}
+
+uint32_t MeowEngine::EnttReflection::FindPropertyPath(uint64_t inPathHash) {
+    std::lock_guard<std::mutex> lock(PathMutex);
+
+    auto pathId = PathIds.find(inPathHash);
+    return pathId != PathIds.end() ? pathId->second : ReflectionPropertyChange::NoPath;
+}
+
+const MeowEngine::ReflectionPropertyPath* MeowEngine::EnttReflection::GetPropertyPath(uint32_t inPathId) const {
+    if(inPathId >= PathCount.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    return &Paths[inPathId];
+}
+
+void MeowEngine::EnttReflection::ApplyPropertyChange(const MeowEngine::ReflectionPropertyChange& inPropertyChange, entt::registry& inRegistry) {
+    const ReflectionPropertyPath* path = GetPropertyPath(inPropertyChange.PathId);
+    if(path == nullptr) {
+        return;
     }
-}
\ No newline at end of file
+
+    const auto changedEntity = static_cast<entt::entity>(inPropertyChange.EntityId);
+
+    // registry may not have the component (anymore), i.e. staging only keeps physics components
+    entt::basic_registry<>::common_type *componentStorage = inRegistry.storage(path->ComponentType);
+    if(componentStorage == nullptr || !componentStorage->contains(changedEntity)) {
+        return;
+    }
+
+    void *component = componentStorage->value(changedEntity);
+
+    path->Set(component, inPropertyChange.GetData(), inPropertyChange.GetDataSize());
+}
+
+const MeowEngine::ReflectionType* MeowEngine::EnttReflection::FindType(entt::id_type inId) const {
+    auto typeIndex = TypeIndices.find(inId);
+    if(typeIndex == TypeIndices.end()) {
+        return nullptr;
+    }
+
+    return &Types[typeIndex->second];
+}
+
+MeowEngine::ReflectionType& MeowEngine::EnttReflection::GetOrAddType(entt::id_type inId, std::string inName) {
+    auto [typeIndex, isAdded] = TypeIndices.try_emplace(inId, static_cast<uint32_t>(Types.size()));
+    if(isAdded) {
+        Types.push_back({inId, std::move(inName), false, {}});
+    }
+
+    return Types[typeIndex->second];
+}
+
+bool MeowEngine::EnttReflection::TryMarkReflected(entt::id_type inId) {
+    return ReflectedTypes.insert(inId).second;
+}
@@ -6,8 +6,17 @@
 #define MEOWENGINE_ENTT_REFLECTION_HPP
 
 #include "unordered_map"
+#include "unordered_set"
 #include "entt_wrapper.hpp"
 #include "vector"
+#include "span"
+#include "string_view"
+#include "cstdint"
+#include "array"
+#include "atomic"
+#include "memory"
+#include "mutex"
+#include "cstring"
 #include "reflection_property.hpp"
 #include "reflection_property_change.hpp"
 #include "string"
@@ -15,44 +24,157 @@
 using namespace std;
 
 namespace MeowEngine {
+    /**
+     * Registered component or class, properties are indexed densely in registration order
+     */
+    struct ReflectionType {
+        entt::id_type Id;
+        std::string Name;
+        bool IsComponent;
+        std::vector<ReflectionProperty> Properties;
+    };
+
+    /**
+     * Interned path from a component down to one of its properties, through nested classes.
+     * Resolved once when interned, nested members live inside their owner so the whole walk is one byte offset.
+     */
+    struct ReflectionPropertyPath {
+        entt::id_type ComponentType;
+        uint64_t Hash; // FNV-1a of "Component.Property.Leaf", same on every run & build unlike path ids
+        uint32_t Offset; // byte offset of the leaf from the component
+        uint32_t Size; // sizeof the leaf
+        bool IsTriviallyCopyable;
+        void (*Assign)(void* inMember, const void* inValue); // only for non trivially copyable leaves
+        uint32_t Depth;
+        std::array<uint32_t, ReflectionPropertyChange::MaxPathDepth> PropertyIndices; // outer to inner
+
+        /**
+         * Copies inValue into the leaf of inComponent, values of another size are rejected
+         * @return false if nothing was written
+         */
+        bool Set(void* inComponent, const void* inValue, std::size_t inValueSize) const {
+            if(inValueSize != Size) {
+                return false;
+            }
+
+            void* member = static_cast<std::byte*>(inComponent) + Offset;
+
+            if(IsTriviallyCopyable) {
+                std::memcpy(member, inValue, Size);
+            }
+            else {
+                Assign(member, inValue);
+            }
+
+            return true;
+        }
+    };
+
     class EnttReflection {
 
     public:
-        EnttReflection() {
+        static constexpr uint32_t NoProperty = UINT32_MAX;
+        static constexpr uint32_t MaxPropertyPaths = 4096;
+
+        EnttReflection()
+        : Paths(std::make_unique<ReflectionPropertyPath[]>(MaxPropertyPaths))
+        , PathCount(0) {
             MeowEngine::Log("Reflection", "Constructed");
         }
         ~EnttReflection() {
             MeowEngine::Log("Reflection", "Destructed");
         }
 
-        bool HasComponent(entt::id_type inId);
-        bool HasProperty(std::string inPropertyName);
-        std::string GetComponentName(entt::id_type inId);
-        std::vector<ReflectionProperty> GetProperties(std::string inClassName);
+        bool HasComponent(entt::id_type inId) const;
+        bool HasType(entt::id_type inId) const;
+
+        /**
+         * Empty for ids that were never registered
+         */
+        const std::string& GetComponentName(entt::id_type inId) const;
+
+        /**
+         * Properties of a registered component / class, empty for unknown ids.
+         * Doesn't allocate, stays valid until something else is registered.
+         */
+        std::span<const ReflectionProperty> GetProperties(entt::id_type inTypeId) const;
+
+        template<typename Type>
+        std::span<const ReflectionProperty> GetProperties() const;
+
+        /**
+         * Dense index of a property on its class or NoProperty, compares names so it's meant for first lookups only
+         */
+        uint32_t FindPropertyIndex(entt::id_type inTypeId, std::string_view inPropertyName) const;
 
+        /**
+         * Runs Type::Reflect() the first time only, scenes register their components on every construction
+         */
         template<typename Type>
         void Reflect();
 
         void RegisterComponent(entt::id_type inId,  std::string inName);
-        void RegisterProperty(std::string inClassName, ReflectionProperty inProperty);
 
-        void ApplyPropertyChange(MeowEngine::ReflectionPropertyChange& inPropertyChange, entt::registry& inRegistry);
+        /**
+         * Registering the same property on a class again is ignored, classes used by many properties reflect once
+         */
+        void RegisterProperty(entt::id_type inClassId, std::string inClassName, ReflectionProperty inProperty);
 
-        void ApplyPropertyChangeData(std::string& inClassName, MeowEngine::ReflectionPropertyChange& inPropertyChange, void* inClassObject) {
-            std::vector<MeowEngine::ReflectionProperty> properties = GetProperties(inClassName);
+        /**
+         * Same component & indices always give the same id, so changes can be keyed & compared by it.
+         * Resolves offset, size & hash the first time a path shows up. Safe to call from any thread.
+         * @param inPropertyIndices outer to inner, see ReflectionPropertyChange::GetPropertyIndices
+         * @return ReflectionPropertyChange::NoPath when the path is empty, too deep, doesn't resolve or the table is full
+         */
+        uint32_t InternPropertyPath(entt::id_type inComponentType, std::span<const uint32_t> inPropertyIndices);
 
-            for(const MeowEngine::ReflectionProperty &property : properties) {
-                if(property.Name == inPropertyChange.PropertyName) {
-                    property.Set(inClassObject, inPropertyChange.Data);
-                }
-            }
-        }
+        /**
+         * Same as above from a dotted path, i.e. "Position.X", for callers that only know names
+         */
+        uint32_t InternPropertyPath(entt::id_type inComponentType, std::string_view inPropertyPath);
+
+        /**
+         * Id of an interned path from its hash, i.e. a change read back from a replay log.
+         * @return ReflectionPropertyChange::NoPath if nothing interned it yet
+         */
+        uint32_t FindPropertyPath(uint64_t inPathHash);
+
+        /**
+         * nullptr for unknown ids, doesn't lock
+         */
+        const ReflectionPropertyPath* GetPropertyPath(uint32_t inPathId) const;
+
+        /**
+         * Changes of entities or components the registry doesn't have are dropped
+         */
+        void ApplyPropertyChange(const MeowEngine::ReflectionPropertyChange& inPropertyChange, entt::registry& inRegistry);
 
     private:
-        std::unordered_map<entt::id_type, std::string> Components;
-        std::unordered_map<std::string, std::vector<ReflectionProperty>> Properties;
+        const ReflectionType* FindType(entt::id_type inId) const;
+        ReflectionType& GetOrAddType(entt::id_type inId, std::string inName);
+
+        /**
+         * @return false when the type was reflected before
+         */
+        bool TryMarkReflected(entt::id_type inId);
+
+        // dense, ids map to their slot
+        std::vector<ReflectionType> Types;
+        std::unordered_map<entt::id_type, uint32_t> TypeIndices;
+        std::unordered_set<entt::id_type> ReflectedTypes;
+
+        // fixed capacity so paths never move while other threads read them, only appends take the lock
+        std::unique_ptr<ReflectionPropertyPath[]> Paths;
+        std::atomic<uint32_t> PathCount;
+        std::unordered_map<uint64_t, uint32_t> PathIds;
+        std::mutex PathMutex;
     };
 
+    template<typename Type>
+    std::span<const ReflectionProperty> EnttReflection::GetProperties() const {
+        return GetProperties(entt::type_hash<Type>::value());
+    }
+
     template<typename Type>
     void EnttReflection::Reflect() {
         if constexpr (std::is_fundamental_v<Type>) {
@@ -62,7 +184,12 @@ namespace MeowEngine {
 //            return PropertyType::ARRAY;
         }
         else if constexpr (std::is_class_v<Type>) {
-            Type::Reflect();
+            // third party classes like glm::vec3 have nothing to reflect, they're copied as a whole
+            if constexpr (requires { Type::Reflect(); }) {
+                if(TryMarkReflected(entt::type_hash<Type>::value())) {
+                    Type::Reflect();
+                }
+            }
         }
         else {
 //            return PropertyType::NOT_DEFINED;
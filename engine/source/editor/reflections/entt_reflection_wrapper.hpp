@@ -25,15 +25,9 @@ namespace MeowEngine {
 
     #define REGISTER_PROPERTY(Class, Property, Type)\
         MeowEngine::Reflection.RegisterProperty(\
+            entt::type_hash<Class>::value(),\
             #Class,\
-            {\
-                #Property,                          \
-                GetPropertyType<Type>(),                                    \
-                GetPropertyTypeId<Type>(),          \
-                #Type,                                    \
-                [](void* obj, const void* value) { ((Class*)obj)->Property = *(Type*)value; },\
-                [](void* obj) -> void* { return &(((Class*)obj)->Property);}\
-            }\
+            MeowEngine::MakeReflectionProperty<Class, Type>(#Property, #Type, &Class::Property)\
         );\
         \
         REFLECT(Type);
@@ -0,0 +1,78 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "property_change_pool.hpp"
+#include "concurrentqueue.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+struct MeowEngine::PropertyChangePool::Internal {
+    Internal()
+    : FreeChanges(BlockSize)
+    , AllocatedCount(0) {}
+
+    ReflectionPropertyChange* Acquire() {
+        ReflectionPropertyChange* change;
+        if(FreeChanges.try_dequeue(change)) {
+            return change;
+        }
+
+        // another thread may have grown the pool while this one waited
+        std::lock_guard<std::mutex> lock(GrowMutex);
+        if(FreeChanges.try_dequeue(change)) {
+            return change;
+        }
+
+        Blocks.push_back(std::make_unique<ReflectionPropertyChange[]>(BlockSize));
+        ReflectionPropertyChange* block = Blocks.back().get();
+
+        std::vector<ReflectionPropertyChange*> freeChanges;
+        freeChanges.reserve(BlockSize - 1);
+        for(std::size_t i = 1; i < BlockSize; i++) {
+            freeChanges.push_back(&block[i]);
+        }
+
+        FreeChanges.enqueue_bulk(freeChanges.data(), freeChanges.size());
+        AllocatedCount.fetch_add(BlockSize, std::memory_order_relaxed);
+
+        return &block[0];
+    }
+
+    void Release(ReflectionPropertyChange* inChange) {
+        inChange->Reset();
+        FreeChanges.enqueue(inChange);
+    }
+
+    std::mutex GrowMutex;
+    std::vector<std::unique_ptr<ReflectionPropertyChange[]>> Blocks;
+    moodycamel::ConcurrentQueue<ReflectionPropertyChange*> FreeChanges;
+    std::atomic<std::size_t> AllocatedCount;
+};
+
+void MeowEngine::PropertyChangeReleaser::operator()(ReflectionPropertyChange* inChange) const {
+    PropertyChangePool::Get().Release(inChange);
+}
+
+MeowEngine::PropertyChangePool& MeowEngine::PropertyChangePool::Get() {
+    // leaked on purpose, queued changes can still be dropped while static destructors run
+    static auto* pool = new PropertyChangePool();
+    return *pool;
+}
+
+MeowEngine::PropertyChangePool::PropertyChangePool()
+: InternalPointer(std::make_unique<Internal>()) {}
+
+MeowEngine::PropertyChangePtr MeowEngine::PropertyChangePool::Acquire() {
+    return PropertyChangePtr(InternalPointer->Acquire());
+}
+
+std::size_t MeowEngine::PropertyChangePool::GetAllocatedCount() const {
+    return InternalPointer->AllocatedCount.load(std::memory_order_relaxed);
+}
+
+void MeowEngine::PropertyChangePool::Release(ReflectionPropertyChange* inChange) {
+    InternalPointer->Release(inChange);
+}
@@ -0,0 +1,53 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_PROPERTY_CHANGE_POOL_HPP
+#define MEOWENGINE_PROPERTY_CHANGE_POOL_HPP
+
+#include "reflection_property_change.hpp"
+#include "memory"
+#include "cstddef"
+
+namespace MeowEngine {
+    struct PropertyChangeReleaser {
+        void operator()(ReflectionPropertyChange* inChange) const;
+    };
+
+    /**
+     * Owning handle of a pooled change, goes back to the pool instead of the heap when dropped
+     */
+    using PropertyChangePtr = std::unique_ptr<ReflectionPropertyChange, PropertyChangeReleaser>;
+
+    /**
+     * Recycles ReflectionPropertyChange records.
+     * Ui acquires on render, main forwards & physics usually drops them, so the free list is shared & lock free.
+     * Records are allocated in blocks when the free list runs dry & are never returned to the heap,
+     * bulk edits after the first few frames don't allocate at all.
+     */
+    class PropertyChangePool {
+    public:
+        static constexpr std::size_t BlockSize = 256;
+
+        static PropertyChangePool& Get();
+
+        PropertyChangePtr Acquire();
+
+        /**
+         * Records ever allocated, stays flat once the pool is warm
+         */
+        std::size_t GetAllocatedCount() const;
+
+    private:
+        friend struct PropertyChangeReleaser;
+
+        PropertyChangePool();
+
+        void Release(ReflectionPropertyChange* inChange);
+
+        struct Internal;
+        std::unique_ptr<Internal> InternalPointer;
+    };
+}
+
+#endif //MEOWENGINE_PROPERTY_CHANGE_POOL_HPP
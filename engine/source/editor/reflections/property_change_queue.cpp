@@ -0,0 +1,76 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "property_change_queue.hpp"
+
+MeowEngine::PropertyChangeQueue::PropertyChangeQueue()
+: PushedCount(0)
+, CoalescedCount(0) {}
+
+void MeowEngine::PropertyChangeQueue::Push(MeowEngine::PropertyChangePtr inChange) {
+    PushedCount++;
+
+    if((Changes.size() + 1) * 2 > ChangeIndices.size()) {
+        GrowChangeIndices();
+    }
+
+    const std::size_t mask = ChangeIndices.size() - 1;
+    std::size_t slot = GetKeyHash(*inChange) & mask;
+
+    while(ChangeIndices[slot] != 0) {
+        MeowEngine::PropertyChangePtr& queuedChange = Changes[ChangeIndices[slot] - 1];
+
+        if(HasSameKey(*queuedChange, *inChange)) {
+            // last writer wins, earlier value is never applied & goes back to the pool
+            queuedChange = std::move(inChange);
+            CoalescedCount++;
+            return;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    Changes.push_back(std::move(inChange));
+    ChangeIndices[slot] = static_cast<uint32_t>(Changes.size());
+}
+
+bool MeowEngine::PropertyChangeQueue::IsEmpty() const {
+    return Changes.empty();
+}
+
+uint64_t MeowEngine::PropertyChangeQueue::GetPushedCount() const {
+    return PushedCount;
+}
+
+uint64_t MeowEngine::PropertyChangeQueue::GetCoalescedCount() const {
+    return CoalescedCount;
+}
+
+bool MeowEngine::PropertyChangeQueue::HasSameKey(const MeowEngine::ReflectionPropertyChange& inChange, const MeowEngine::ReflectionPropertyChange& inOther) {
+    return inChange.EntityId == inOther.EntityId
+        && inChange.ComponentType == inOther.ComponentType
+        && inChange.PathId == inOther.PathId;
+}
+
+std::size_t MeowEngine::PropertyChangeQueue::GetKeyHash(const MeowEngine::ReflectionPropertyChange& inChange) {
+    std::size_t hash = std::hash<uint32_t>()(inChange.PathId);
+    hash ^= std::hash<int>()(inChange.EntityId) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<entt::id_type>()(inChange.ComponentType) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+void MeowEngine::PropertyChangeQueue::GrowChangeIndices() {
+    ChangeIndices.assign(std::max<std::size_t>(64, ChangeIndices.size() * 2), 0);
+
+    const std::size_t mask = ChangeIndices.size() - 1;
+    for(std::size_t i = 0; i < Changes.size(); i++) {
+        std::size_t slot = GetKeyHash(*Changes[i]) & mask;
+
+        while(ChangeIndices[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+
+        ChangeIndices[slot] = static_cast<uint32_t>(i + 1);
+    }
+}
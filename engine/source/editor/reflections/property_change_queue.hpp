@@ -0,0 +1,79 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_PROPERTY_CHANGE_QUEUE_HPP
+#define MEOWENGINE_PROPERTY_CHANGE_QUEUE_HPP
+
+#include "property_change_pool.hpp"
+#include "vector"
+#include "algorithm"
+#include "cstdint"
+
+namespace MeowEngine {
+    /**
+     * UI property changes of one frame, keyed by (entity, component, interned property path).
+     * A later change to the same key replaces the earlier one in place, so a frame of edits applies every property
+     * once with its latest value, in the order properties were first edited.
+     * Written by render (ui) & drained by main while render waits at sync.
+     */
+    class PropertyChangeQueue {
+    public:
+        PropertyChangeQueue();
+
+        /**
+         * Replaced changes go back to the pool right away
+         */
+        void Push(MeowEngine::PropertyChangePtr inChange);
+
+        /**
+         * Calls inCallback(change) for every coalesced change & empties the queue, changes left in their handle go back
+         * to the pool
+         */
+        template<typename Callback>
+        void Drain(Callback&& inCallback);
+
+        bool IsEmpty() const;
+
+        /**
+         * Changes pushed since start
+         */
+        uint64_t GetPushedCount() const;
+
+        /**
+         * Pushed changes replaced by a later one before being applied, i.e. writes saved
+         */
+        uint64_t GetCoalescedCount() const;
+
+    private:
+        static bool HasSameKey(const MeowEngine::ReflectionPropertyChange& inChange, const MeowEngine::ReflectionPropertyChange& inOther);
+        static std::size_t GetKeyHash(const MeowEngine::ReflectionPropertyChange& inChange);
+
+        /**
+         * Doubles the index & puts queued changes back in, index stays at least twice the change count
+         */
+        void GrowChangeIndices();
+
+        std::vector<MeowEngine::PropertyChangePtr> Changes;
+
+        // open addressing, change index + 1 per slot & 0 when free, both vectors keep their capacity across frames
+        std::vector<uint32_t> ChangeIndices;
+
+        uint64_t PushedCount;
+        uint64_t CoalescedCount;
+    };
+
+    template<typename Callback>
+    void PropertyChangeQueue::Drain(Callback&& inCallback) {
+        for(MeowEngine::PropertyChangePtr& change : Changes) {
+            inCallback(change);
+        }
+
+        if(!Changes.empty()) {
+            Changes.clear();
+            std::fill(ChangeIndices.begin(), ChangeIndices.end(), 0);
+        }
+    }
+}
+
+#endif //MEOWENGINE_PROPERTY_CHANGE_QUEUE_HPP
@@ -6,7 +6,12 @@
 #define MEOWENGINE_REFLECTION_PROPERTY_HPP
 
 #include "string"
-#include "functional"
+#include "cstdint"
+#include "cstddef"
+#include "cstring"
+#include "type_traits"
+#include "memory"
+#include "entt_wrapper.hpp"
 #include "property_type.hpp"
 
 using namespace std;
@@ -17,9 +22,97 @@ namespace MeowEngine {
         MeowEngine::PropertyType Type; // type of class
         const type_info& TypeId; // type id of class
         std::string TypeName; // name of class
-        std::function<void(void *, const void *)> Set;
-        std::function<void *(void *)> Get;
+        entt::id_type TypeHash; // entt type hash of class, looks up its properties
+        uint32_t Index; // dense index on the owning class, set when registered
+        uint32_t Offset; // byte offset of the member in the owning class
+        uint32_t Size; // sizeof the member
+        bool IsTriviallyCopyable; // set is a plain memcpy
+        void (*Assign)(void* inMember, const void* inValue); // copy assignment, only for non trivially copyable types
+
+        void* Get(void* inObject) const {
+            return static_cast<std::byte*>(inObject) + Offset;
+        }
+
+        /**
+         * Copies inValue into the member, values of another size are rejected
+         * @return false if nothing was written
+         */
+        bool Set(void* inObject, const void* inValue, std::size_t inValueSize) const {
+            if(inValueSize != Size) {
+                return false;
+            }
+
+            if(IsTriviallyCopyable) {
+                std::memcpy(Get(inObject), inValue, Size);
+            }
+            else {
+                Assign(Get(inObject), inValue);
+            }
+
+            return true;
+        }
     };
+
+    template<typename Type>
+    void AssignProperty(void* inMember, const void* inValue) {
+        *static_cast<Type*>(inMember) = *static_cast<const Type*>(inValue);
+    }
+
+    /**
+     * Instance member offsets are measured on, default constructed unless the class provides
+     * a static CreateReflectionPrototype() because it has no default constructor
+     */
+    template<typename Class>
+    Class CreateReflectionPrototype() {
+        if constexpr (requires { Class::CreateReflectionPrototype(); }) {
+            return Class::CreateReflectionPrototype();
+        }
+        else {
+            return Class();
+        }
+    }
+
+    /**
+     * One prototype per class, all of its properties are measured on it
+     */
+    template<typename Class>
+    const Class& GetReflectionPrototype() {
+        static const Class prototype = CreateReflectionPrototype<Class>();
+        return prototype;
+    }
+
+    /**
+     * Byte offset of a member measured on a constructed object,
+     * works for components with virtual functions where offsetof isn't supported
+     */
+    template<typename Class, typename Type>
+    uint32_t GetMemberOffset(const Class& inObject, Type Class::* inMember) {
+        const std::byte* object = reinterpret_cast<const std::byte*>(std::addressof(inObject));
+        const std::byte* member = reinterpret_cast<const std::byte*>(std::addressof(inObject.*inMember));
+
+        return static_cast<uint32_t>(member - object);
+    }
+
+    /**
+     * Member pointer has to match Type, so a wrong type in REGISTER_PROPERTY doesn't compile
+     */
+    template<typename Class, typename Type>
+    ReflectionProperty MakeReflectionProperty(const char* inName, const char* inTypeName, Type Class::* inMember) {
+        constexpr bool isTriviallyCopyable = std::is_trivially_copyable_v<Type>;
+
+        return {
+            inName,
+            GetPropertyType<Type>(),
+            GetPropertyTypeId<Type>(),
+            inTypeName,
+            entt::type_hash<Type>::value(),
+            UINT32_MAX,
+            GetMemberOffset(GetReflectionPrototype<Class>(), inMember),
+            static_cast<uint32_t>(sizeof(Type)),
+            isTriviallyCopyable,
+            isTriviallyCopyable ? nullptr : &AssignProperty<Type>
+        };
+    }
 }
 
 #endif //MEOWENGINE_REFLECTION_PROPERTY_HPP
@@ -4,22 +4,61 @@
 
 #include "reflection_property_change.hpp"
 
-#include <utility>
-#include "log.hpp"
-
-MeowEngine::ReflectionPropertyChange::ReflectionPropertyChange(const std::string& inPropertyChangeName, void* inChangeData, std::function<void(void*)> inDataDeleter)
-        : PropertyName(inPropertyChangeName)
-        , ClassProperties()
-        , Data(inChangeData)
-        , DataDeleter(std::move(inDataDeleter)){
-    MeowEngine::Log("MeowEngine::ReflectionPropertyChange", "Constructed");
-}
+MeowEngine::ReflectionPropertyChange::ReflectionPropertyChange()
+        : EntityId(0)
+        , ComponentType(0)
+        , PathId(NoPath)
+        , PropertyIndices()
+        , PathDepth(0)
+        , DataSize(0)
+        , DataDestructor(nullptr) {}
 
 MeowEngine::ReflectionPropertyChange::~ReflectionPropertyChange() {
-    MeowEngine::Log("MeowEngine::ReflectionPropertyChange", "Destructed");
+    DestroyData();
+}
+
+const void* MeowEngine::ReflectionPropertyChange::GetData() const {
+    return Data;
+}
+
+std::size_t MeowEngine::ReflectionPropertyChange::GetDataSize() const {
+    return DataSize;
+}
+
+bool MeowEngine::ReflectionPropertyChange::PushOuterProperty(uint32_t inPropertyIndex) {
+    if(PathDepth == MaxPathDepth) {
+        return false;
+    }
+
+    // depth is tiny, shifting keeps indices outer to inner without a second pass
+    for(uint32_t i = PathDepth; i > 0; i--) {
+        PropertyIndices[i] = PropertyIndices[i - 1];
+    }
+
+    PropertyIndices[0] = inPropertyIndex;
+    PathDepth++;
 
-//    MeowEngine::Log("Before Des", *static_cast<int*>(Data));
-    DataDeleter(Data);
-//    delete static_cast<int*>(Data);
-//    MeowEngine::Log("After Des", *static_cast<int*>(Data));
-}
\ No newline at end of file
+    return true;
+}
+
+std::span<const uint32_t> MeowEngine::ReflectionPropertyChange::GetPropertyIndices() const {
+    return {PropertyIndices.data(), PathDepth};
+}
+
+void MeowEngine::ReflectionPropertyChange::Reset() {
+    DestroyData();
+
+    EntityId = 0;
+    ComponentType = 0;
+    PathId = NoPath;
+    PathDepth = 0;
+}
+
+void MeowEngine::ReflectionPropertyChange::DestroyData() {
+    if(DataDestructor != nullptr) {
+        DataDestructor(Data);
+        DataDestructor = nullptr;
+    }
+
+    DataSize = 0;
+}
@@ -6,29 +6,86 @@
 #define MEOWENGINE_REFLECTION_PROPERTY_CHANGE_HPP
 
 #include "entt_wrapper.hpp"
-#include "reflection_property.hpp"
+#include "array"
+#include "cstddef"
+#include "cstdint"
+#include "new"
+#include "span"
+#include "type_traits"
 
 namespace MeowEngine {
+    /**
+     * Fixed size record of one ui edit, the value lives inline & the property is an interned path id.
+     * Records come from PropertyChangePool & go back to it, copying or moving one around isn't allowed.
+     */
     class ReflectionPropertyChange {
-    private:
-        ReflectionPropertyChange() {}
     public:
-        ReflectionPropertyChange(const std::string& inPropertyChangeName, void* inChangeData, std::function<void(void*)> inDataDeleter);
+        static constexpr std::size_t InlineDataSize = 48;
+        static constexpr std::size_t MaxPathDepth = 8;
+        static constexpr uint32_t NoPath = UINT32_MAX;
+
+        ReflectionPropertyChange();
         ~ReflectionPropertyChange();
 
-        static void Assign(ReflectionPropertyChange*& inTarget, ReflectionPropertyChange* inValue) {
-            if(inValue != nullptr) {
-                inTarget = inValue;
-            }
-        }
+        ReflectionPropertyChange(const ReflectionPropertyChange&) = delete;
+        ReflectionPropertyChange& operator=(const ReflectionPropertyChange&) = delete;
+
+        /**
+         * Copy constructs inValue into inline storage, replacing the previous value
+         */
+        template<typename Type>
+        void SetValue(const Type& inValue);
+
+        const void* GetData() const;
+        std::size_t GetDataSize() const;
+
+        /**
+         * Adds the property one class level up, ui calls it from the edited property outwards while it unwinds
+         * @return false if the path is deeper than MaxPathDepth
+         */
+        bool PushOuterProperty(uint32_t inPropertyIndex);
+
+        /**
+         * Dense property indices from the component down to the edited property
+         */
+        std::span<const uint32_t> GetPropertyIndices() const;
+
+        /**
+         * Destroys the value & clears everything, called when the record goes back to the pool
+         */
+        void Reset();
 
         int EntityId;
         entt::id_type ComponentType;
-        std::string PropertyName;
-        std::vector <MeowEngine::ReflectionProperty> ClassProperties;
-        void* Data;
-        std::function<void(void*)> DataDeleter;
+
+        // interned property path, see EnttReflection::InternPropertyPath
+        uint32_t PathId;
+
+    private:
+        void DestroyData();
+
+        std::array<uint32_t, MaxPathDepth> PropertyIndices;
+        uint32_t PathDepth;
+
+        uint32_t DataSize;
+        void (*DataDestructor)(void* inData); // only set for non trivially destructible values
+        alignas(std::max_align_t) std::byte Data[InlineDataSize];
     };
+
+    template<typename Type>
+    void ReflectionPropertyChange::SetValue(const Type& inValue) {
+        static_assert(sizeof(Type) <= InlineDataSize, "Property value doesn't fit inline storage");
+        static_assert(alignof(Type) <= alignof(std::max_align_t), "Property value is over aligned");
+
+        DestroyData();
+
+        ::new(static_cast<void*>(Data)) Type(inValue);
+        DataSize = static_cast<uint32_t>(sizeof(Type));
+
+        if constexpr (!std::is_trivially_destructible_v<Type>) {
+            DataDestructor = [](void* inData) { static_cast<Type*>(inData)->~Type(); };
+        }
+    }
 }
 
 #endif //MEOWENGINE_REFLECTION_PROPERTY_CHANGE_HPP
@@ -0,0 +1,126 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "mapped_file.hpp"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#ifdef _WIN32
+MeowEngine::MappedFile::MappedFile()
+: Data(nullptr)
+, Size(0)
+, FileHandle(INVALID_HANDLE_VALUE)
+, MappingHandle(nullptr) {}
+#else
+MeowEngine::MappedFile::MappedFile()
+: Data(nullptr)
+, Size(0)
+, FileDescriptor(-1) {}
+#endif
+
+MeowEngine::MappedFile::~MappedFile() {
+    Close();
+}
+
+bool MeowEngine::MappedFile::Open(const std::string& inPath) {
+    Close();
+
+#ifdef _WIN32
+    FileHandle = CreateFileA(inPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(FileHandle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if(!GetFileSizeEx(FileHandle, &fileSize) || fileSize.QuadPart == 0) {
+        Close();
+        return false;
+    }
+
+    MappingHandle = CreateFileMappingA(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if(MappingHandle == nullptr) {
+        Close();
+        return false;
+    }
+
+    Data = static_cast<const std::byte*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+    Size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    FileDescriptor = open(inPath.c_str(), O_RDONLY);
+    if(FileDescriptor < 0) {
+        return false;
+    }
+
+    struct stat fileStatus;
+    if(fstat(FileDescriptor, &fileStatus) != 0 || fileStatus.st_size == 0) {
+        Close();
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, static_cast<std::size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+    if(mapping == MAP_FAILED) {
+        Close();
+        return false;
+    }
+
+    // blocks are read front to back once, let the os read ahead
+    madvise(mapping, static_cast<std::size_t>(fileStatus.st_size), MADV_SEQUENTIAL);
+
+    Data = static_cast<const std::byte*>(mapping);
+    Size = static_cast<std::size_t>(fileStatus.st_size);
+#endif
+
+    if(Data == nullptr) {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void MeowEngine::MappedFile::Close() {
+#ifdef _WIN32
+    if(Data != nullptr) {
+        UnmapViewOfFile(Data);
+    }
+
+    if(MappingHandle != nullptr) {
+        CloseHandle(MappingHandle);
+        MappingHandle = nullptr;
+    }
+
+    if(FileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(FileHandle);
+        FileHandle = INVALID_HANDLE_VALUE;
+    }
+#else
+    if(Data != nullptr) {
+        munmap(const_cast<std::byte*>(Data), Size);
+    }
+
+    if(FileDescriptor >= 0) {
+        close(FileDescriptor);
+        FileDescriptor = -1;
+    }
+#endif
+
+    Data = nullptr;
+    Size = 0;
+}
+
+const std::byte* MeowEngine::MappedFile::GetData() const {
+    return Data;
+}
+
+std::size_t MeowEngine::MappedFile::GetSize() const {
+    return Size;
+}
@@ -0,0 +1,46 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_MAPPED_FILE_HPP
+#define MEOWENGINE_MAPPED_FILE_HPP
+
+#include "string"
+#include "cstddef"
+
+namespace MeowEngine {
+    /**
+     * Read only view of a whole file mapped into memory, pages are loaded by the os as they're touched.
+     * Unmapped when closed or destroyed, pointers into it don't outlive it.
+     */
+    class MappedFile {
+    public:
+        MappedFile();
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @return false if the file is missing, empty or couldn't be mapped
+         */
+        bool Open(const std::string& inPath);
+        void Close();
+
+        const std::byte* GetData() const;
+        std::size_t GetSize() const;
+
+    private:
+        const std::byte* Data;
+        std::size_t Size;
+
+#ifdef _WIN32
+        void* FileHandle;
+        void* MappingHandle;
+#else
+        int FileDescriptor;
+#endif
+    };
+}
+
+#endif //MEOWENGINE_MAPPED_FILE_HPP
@@ -0,0 +1,18 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "scene_file_format.hpp"
+
+uint64_t MeowEngine::HashSceneBytes(std::string_view inBytes, uint64_t inHash) {
+    for(char byte : inBytes) {
+        inHash ^= static_cast<uint8_t>(byte);
+        inHash *= 0x100000001b3ull;
+    }
+
+    return inHash;
+}
+
+uint64_t MeowEngine::AlignSceneOffset(uint64_t inOffset) {
+    return (inOffset + SceneFileAlignment - 1) & ~static_cast<uint64_t>(SceneFileAlignment - 1);
+}
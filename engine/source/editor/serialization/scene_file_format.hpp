@@ -0,0 +1,80 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_SCENE_FILE_FORMAT_HPP
+#define MEOWENGINE_SCENE_FILE_FORMAT_HPP
+
+#include "cstdint"
+#include "cstddef"
+#include "string_view"
+
+namespace MeowEngine {
+    /**
+     * Binary scene layout, every offset is from the start of the file & every section starts 8 byte aligned so it can
+     * be read in place from a mapped file. Host byte order, files aren't meant to move between architectures.
+     *
+     *  SceneFileHeader
+     *  SceneBlockHeader[BlockCount]        one per component type
+     *  per block
+     *      SceneFieldHeader[FieldCount]    flattened reflected properties, the schema records were written with
+     *      uint32_t[Count]                 entity index in the file, ascending
+     *      std::byte[Count * RecordSize]   one packed record per entity
+     *  char[StringsSize]                   names & string values, not null terminated
+     */
+    constexpr uint32_t SceneFileMagic = 0x574F454D; // "MEOW"
+    constexpr uint32_t SceneFileVersion = 1;
+    constexpr uint32_t SceneFileAlignment = 8;
+
+    enum class SceneFieldKind : uint32_t {
+        // memcpy of the member bytes
+        Bytes,
+        // PString, record keeps SceneStringReference into the string table
+        String
+    };
+
+    struct SceneStringReference {
+        uint32_t Offset;
+        uint32_t Length;
+    };
+
+    struct SceneFileHeader {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t EntityCount;
+        uint32_t BlockCount;
+        uint64_t BlockTableOffset;
+        uint64_t StringsOffset;
+        uint64_t StringsSize;
+    };
+
+    struct SceneBlockHeader {
+        uint64_t SchemaHash;
+        SceneStringReference ComponentName;
+        uint32_t ComponentType; // entt type hash when written, compiler dependent so name is the fallback
+        uint32_t Count;
+        uint32_t RecordSize;
+        uint32_t FieldCount;
+        uint64_t FieldsOffset;
+        uint64_t EntitiesOffset;
+        uint64_t RecordsOffset;
+    };
+
+    struct SceneFieldHeader {
+        SceneStringReference Path; // i.e. "Position.X"
+        SceneStringReference TypeName;
+        SceneFieldKind Kind;
+        uint32_t RecordOffset;
+        uint32_t Size; // member size, string fields are sizeof(SceneStringReference) in records
+        uint32_t Padding;
+    };
+
+    /**
+     * FNV-1a, continues from inHash so fields can be hashed one after another
+     */
+    uint64_t HashSceneBytes(std::string_view inBytes, uint64_t inHash = 0xcbf29ce484222325ull);
+
+    uint64_t AlignSceneOffset(uint64_t inOffset);
+}
+
+#endif //MEOWENGINE_SCENE_FILE_FORMAT_HPP
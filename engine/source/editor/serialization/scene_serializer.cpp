@@ -0,0 +1,446 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "scene_serializer.hpp"
+#include "mapped_file.hpp"
+#include "entt_reflection_wrapper.hpp"
+#include "pstring.hpp"
+#include "log.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    struct BlockWrite {
+        MeowEngine::SceneBlockHeader Header;
+        std::vector<MeowEngine::SceneFieldHeader> Fields;
+        std::vector<uint32_t> Entities;
+        std::vector<std::byte> Records;
+    };
+
+    /**
+     * Blocks checked & matched against the current schema, kept until every block passed
+     */
+    struct BlockLoad {
+        const MeowEngine::SceneBlockHeader* Header;
+        const uint32_t* Entities;
+        std::vector<MeowEngine::SceneFieldCopy> Copies;
+    };
+
+    class StringTable {
+    public:
+        MeowEngine::SceneStringReference Add(std::string_view inString) {
+            MeowEngine::SceneStringReference reference{static_cast<uint32_t>(Strings.size()), static_cast<uint32_t>(inString.size())};
+            Strings.append(inString);
+            return reference;
+        }
+
+        std::string Strings;
+    };
+
+    bool IsValidString(MeowEngine::SceneStringReference inReference, std::string_view inStrings) {
+        return inReference.Offset <= inStrings.size() && inReference.Length <= inStrings.size() - inReference.Offset;
+    }
+
+    std::string_view GetString(MeowEngine::SceneStringReference inReference, std::string_view inStrings) {
+        return inStrings.substr(inReference.Offset, inReference.Length);
+    }
+
+    uint32_t GetRecordSize(MeowEngine::SceneFieldKind inKind, uint32_t inSize) {
+        return inKind == MeowEngine::SceneFieldKind::String ? static_cast<uint32_t>(sizeof(MeowEngine::SceneStringReference)) : inSize;
+    }
+
+    uint32_t GetRecordSize(const std::vector<MeowEngine::SceneField>& inFields) {
+        return inFields.empty() ? 0 : inFields.back().RecordOffset + GetRecordSize(inFields.back().Kind, inFields.back().Size);
+    }
+
+    void CollectFields(entt::id_type inClassId, const std::string& inPrefix, uint32_t inOffset, std::vector<MeowEngine::SceneField>& outFields) {
+        for(const MeowEngine::ReflectionProperty& property : MeowEngine::Reflection.GetProperties(inClassId)) {
+            const std::string path = inPrefix + property.Name;
+            const uint32_t offset = inOffset + property.Offset;
+
+            // classes with reflected properties are walked, so a field added to Vector3 doesn't shift everything else
+            if(property.Type == MeowEngine::CLASS_OR_STRUCT && !MeowEngine::Reflection.GetProperties(property.TypeHash).empty()) {
+                CollectFields(property.TypeHash, path + ".", offset, outFields);
+            }
+            else if(property.IsTriviallyCopyable) {
+                outFields.push_back({path, property.TypeName, MeowEngine::SceneFieldKind::Bytes, offset, property.Size, 0});
+            }
+            else if(property.TypeHash == entt::type_hash<MeowEngine::PString>::value()) {
+                outFields.push_back({path, property.TypeName, MeowEngine::SceneFieldKind::String, offset, property.Size, 0});
+            }
+            else {
+                MeowEngine::Log("Scene Serializer", "Can't serialize " + path + " of type " + property.TypeName);
+            }
+        }
+    }
+
+    /**
+     * Schema didn't change, record & component layouts are known up front & neighbours are copied together
+     */
+    std::vector<MeowEngine::SceneFieldCopy> GetMatchingCopies(const std::vector<MeowEngine::SceneField>& inFields) {
+        std::vector<MeowEngine::SceneFieldCopy> copies;
+
+        for(const MeowEngine::SceneField& field : inFields) {
+            if(!copies.empty() && field.Kind == MeowEngine::SceneFieldKind::Bytes) {
+                MeowEngine::SceneFieldCopy& previous = copies.back();
+
+                if(previous.Kind == MeowEngine::SceneFieldKind::Bytes
+                   && previous.RecordOffset + previous.Size == field.RecordOffset
+                   && previous.ComponentOffset + previous.Size == field.ComponentOffset) {
+                    previous.Size += field.Size;
+                    continue;
+                }
+            }
+
+            copies.push_back({field.Kind, field.RecordOffset, field.ComponentOffset, field.Size});
+        }
+
+        return copies;
+    }
+
+    /**
+     * Schema changed, fields are matched one by one by path & type. Fields only the file has are dropped.
+     */
+    std::vector<MeowEngine::SceneFieldCopy> GetChangedCopies(std::span<const MeowEngine::SceneFieldHeader> inFileFields, const std::vector<MeowEngine::SceneField>& inFields, std::string_view inStrings) {
+        std::vector<MeowEngine::SceneFieldCopy> copies;
+
+        for(const MeowEngine::SceneFieldHeader& fileField : inFileFields) {
+            const std::string_view path = ::GetString(fileField.Path, inStrings);
+            const std::string_view typeName = ::GetString(fileField.TypeName, inStrings);
+
+            auto field = std::find_if(inFields.begin(), inFields.end(), [&](const MeowEngine::SceneField& inField) {
+                // strings are stored by value, only raw bytes have to match in size
+                return inField.Path == path && inField.TypeName == typeName && inField.Kind == fileField.Kind
+                       && (inField.Kind == MeowEngine::SceneFieldKind::String || inField.Size == fileField.Size);
+            });
+
+            if(field != inFields.end()) {
+                copies.push_back({field->Kind, fileField.RecordOffset, field->ComponentOffset, field->Size});
+            }
+        }
+
+        return copies;
+    }
+
+    void WritePadding(std::ofstream& inFile, uint64_t inOffset) {
+        static const char padding[MeowEngine::SceneFileAlignment] = {};
+
+        const uint64_t position = static_cast<uint64_t>(inFile.tellp());
+        if(inOffset > position) {
+            inFile.write(padding, static_cast<std::streamsize>(inOffset - position));
+        }
+    }
+}
+
+std::vector<MeowEngine::SceneField> MeowEngine::SceneSerializer::GetFields(entt::id_type inComponentType) {
+    std::vector<SceneField> fields;
+    ::CollectFields(inComponentType, "", 0, fields);
+
+    uint32_t recordOffset = 0;
+    for(SceneField& field : fields) {
+        field.RecordOffset = recordOffset;
+        recordOffset += ::GetRecordSize(field.Kind, field.Size);
+    }
+
+    return fields;
+}
+
+uint64_t MeowEngine::SceneSerializer::GetSchemaHash(std::string_view inComponentName, const std::vector<SceneField>& inFields) {
+    uint64_t hash = MeowEngine::HashSceneBytes(inComponentName);
+
+    for(const SceneField& field : inFields) {
+        const uint32_t layout[] = {static_cast<uint32_t>(field.Kind), field.Size, field.RecordOffset};
+
+        hash = MeowEngine::HashSceneBytes(field.Path, hash);
+        hash = MeowEngine::HashSceneBytes(field.TypeName, hash);
+        hash = MeowEngine::HashSceneBytes({reinterpret_cast<const char*>(layout), sizeof(layout)}, hash);
+    }
+
+    return hash;
+}
+
+bool MeowEngine::SceneSerializer::Save(const std::string& inPath, entt::registry& inRegistry) const {
+    // file indices follow entity storage order, loading creates them again in the same order
+    std::vector<entt::entity> entities;
+    std::vector<uint32_t> fileIndices;
+
+    for(auto [entity] : inRegistry.storage<entt::entity>().each()) {
+        const std::size_t entityIndex = entt::to_entity(entity);
+        if(entityIndex >= fileIndices.size()) {
+            fileIndices.resize(entityIndex + 1);
+        }
+
+        fileIndices[entityIndex] = static_cast<uint32_t>(entities.size());
+        entities.push_back(entity);
+    }
+
+    StringTable strings;
+    std::vector<BlockWrite> blocks;
+
+    for(auto [type, storage] : inRegistry.storage()) {
+        if(!MeowEngine::Reflection.HasComponent(type) || storage.empty()) {
+            continue;
+        }
+
+        const std::string& componentName = MeowEngine::Reflection.GetComponentName(type);
+        const std::vector<SceneField> fields = GetFields(type);
+        const uint32_t recordSize = ::GetRecordSize(fields);
+
+        BlockWrite& block = blocks.emplace_back();
+
+        for(const SceneField& field : fields) {
+            block.Fields.push_back({strings.Add(field.Path), strings.Add(field.TypeName), field.Kind, field.RecordOffset, field.Size, 0});
+        }
+
+        for(entt::entity entity : storage) {
+            block.Entities.push_back(fileIndices[entt::to_entity(entity)]);
+        }
+
+        // ascending entity order keeps loads walking the registry front to back
+        std::sort(block.Entities.begin(), block.Entities.end());
+        block.Records.resize(block.Entities.size() * recordSize);
+
+        for(std::size_t i = 0; i < block.Entities.size(); i++) {
+            const auto* component = static_cast<const std::byte*>(storage.value(entities[block.Entities[i]]));
+            std::byte* record = block.Records.data() + i * recordSize;
+
+            for(const SceneField& field : fields) {
+                if(field.Kind == SceneFieldKind::String) {
+                    const auto& value = *reinterpret_cast<const MeowEngine::PString*>(component + field.ComponentOffset);
+                    const SceneStringReference reference = strings.Add(value);
+                    std::memcpy(record + field.RecordOffset, &reference, sizeof(reference));
+                }
+                else {
+                    std::memcpy(record + field.RecordOffset, component + field.ComponentOffset, field.Size);
+                }
+            }
+        }
+
+        block.Header.SchemaHash = GetSchemaHash(componentName, fields);
+        block.Header.ComponentName = strings.Add(componentName);
+        block.Header.ComponentType = type;
+        block.Header.Count = static_cast<uint32_t>(block.Entities.size());
+        block.Header.RecordSize = recordSize;
+        block.Header.FieldCount = static_cast<uint32_t>(block.Fields.size());
+    }
+
+    // layout
+    SceneFileHeader header{};
+    header.Magic = SceneFileMagic;
+    header.Version = SceneFileVersion;
+    header.EntityCount = static_cast<uint32_t>(entities.size());
+    header.BlockCount = static_cast<uint32_t>(blocks.size());
+    header.BlockTableOffset = MeowEngine::AlignSceneOffset(sizeof(SceneFileHeader));
+
+    uint64_t offset = header.BlockTableOffset + blocks.size() * sizeof(SceneBlockHeader);
+    for(BlockWrite& block : blocks) {
+        block.Header.FieldsOffset = MeowEngine::AlignSceneOffset(offset);
+        block.Header.EntitiesOffset = MeowEngine::AlignSceneOffset(block.Header.FieldsOffset + block.Fields.size() * sizeof(SceneFieldHeader));
+        block.Header.RecordsOffset = MeowEngine::AlignSceneOffset(block.Header.EntitiesOffset + block.Entities.size() * sizeof(uint32_t));
+        offset = block.Header.RecordsOffset + block.Records.size();
+    }
+
+    header.StringsOffset = MeowEngine::AlignSceneOffset(offset);
+    header.StringsSize = strings.Strings.size();
+
+    // write
+    std::ofstream file(inPath, std::ios::binary | std::ios::trunc);
+    if(!file) {
+        MeowEngine::Log("Scene Serializer", "Couldn't write " + inPath);
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    ::WritePadding(file, header.BlockTableOffset);
+    for(const BlockWrite& block : blocks) {
+        file.write(reinterpret_cast<const char*>(&block.Header), sizeof(block.Header));
+    }
+
+    for(const BlockWrite& block : blocks) {
+        ::WritePadding(file, block.Header.FieldsOffset);
+        file.write(reinterpret_cast<const char*>(block.Fields.data()), static_cast<std::streamsize>(block.Fields.size() * sizeof(SceneFieldHeader)));
+
+        ::WritePadding(file, block.Header.EntitiesOffset);
+        file.write(reinterpret_cast<const char*>(block.Entities.data()), static_cast<std::streamsize>(block.Entities.size() * sizeof(uint32_t)));
+
+        ::WritePadding(file, block.Header.RecordsOffset);
+        file.write(reinterpret_cast<const char*>(block.Records.data()), static_cast<std::streamsize>(block.Records.size()));
+    }
+
+    ::WritePadding(file, header.StringsOffset);
+    file.write(strings.Strings.data(), static_cast<std::streamsize>(strings.Strings.size()));
+
+    if(!file) {
+        MeowEngine::Log("Scene Serializer", "Couldn't write " + inPath);
+        return false;
+    }
+
+    MeowEngine::Log("Scene Serializer", "Saved " + std::to_string(entities.size()) + " entities to " + inPath);
+    return true;
+}
+
+bool MeowEngine::SceneSerializer::Load(const std::string& inPath, MeowEngine::EnttBuffer& inBuffer) const {
+    const auto startTime = std::chrono::steady_clock::now();
+
+    MappedFile file;
+    if(!file.Open(inPath)) {
+        MeowEngine::Log("Scene Serializer", "Couldn't open " + inPath);
+        return false;
+    }
+
+    const std::byte* data = file.GetData();
+    const uint64_t fileSize = file.GetSize();
+
+    // sections are read in place, so they have to be inside the file & aligned for their headers
+    auto isInFile = [&](uint64_t inOffset, uint64_t inByteCount) {
+        return inOffset % SceneFileAlignment == 0 && inOffset <= fileSize && inByteCount <= fileSize - inOffset;
+    };
+
+    SceneFileHeader header;
+    if(fileSize < sizeof(header)) {
+        MeowEngine::Log("Scene Serializer", inPath + " is not a scene file");
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if(header.Magic != SceneFileMagic) {
+        MeowEngine::Log("Scene Serializer", inPath + " is not a scene file");
+        return false;
+    }
+
+    if(header.Version != SceneFileVersion) {
+        MeowEngine::Log("Scene Serializer", inPath + " has unsupported version " + std::to_string(header.Version));
+        return false;
+    }
+
+    if(!isInFile(header.BlockTableOffset, static_cast<uint64_t>(header.BlockCount) * sizeof(SceneBlockHeader))
+       || header.StringsOffset > fileSize || header.StringsSize > fileSize - header.StringsOffset) {
+        MeowEngine::Log("Scene Serializer", inPath + " is truncated");
+        return false;
+    }
+
+    const std::string_view strings(reinterpret_cast<const char*>(data + header.StringsOffset), header.StringsSize);
+    const std::span<const SceneBlockHeader> blockHeaders(reinterpret_cast<const SceneBlockHeader*>(data + header.BlockTableOffset), header.BlockCount);
+
+    // every block is checked before anything is added, a broken file doesn't leave half a scene behind
+    std::vector<BlockLoad> blocks;
+    std::vector<const ComponentLoader*> loaders;
+
+    for(const SceneBlockHeader& block : blockHeaders) {
+        const uint64_t recordsSize = static_cast<uint64_t>(block.Count) * block.RecordSize;
+
+        if(!::IsValidString(block.ComponentName, strings)
+           || !isInFile(block.FieldsOffset, static_cast<uint64_t>(block.FieldCount) * sizeof(SceneFieldHeader))
+           || !isInFile(block.EntitiesOffset, static_cast<uint64_t>(block.Count) * sizeof(uint32_t))
+           || !isInFile(block.RecordsOffset, recordsSize)) {
+            MeowEngine::Log("Scene Serializer", inPath + " is truncated");
+            return false;
+        }
+
+        const std::span<const SceneFieldHeader> fileFields(reinterpret_cast<const SceneFieldHeader*>(data + block.FieldsOffset), block.FieldCount);
+        for(const SceneFieldHeader& field : fileFields) {
+            if(!::IsValidString(field.Path, strings) || !::IsValidString(field.TypeName, strings)
+               || field.RecordOffset > block.RecordSize || ::GetRecordSize(field.Kind, field.Size) > block.RecordSize - field.RecordOffset) {
+                MeowEngine::Log("Scene Serializer", inPath + " has a broken field table");
+                return false;
+            }
+        }
+
+        const auto* entities = reinterpret_cast<const uint32_t*>(data + block.EntitiesOffset);
+        if(std::any_of(entities, entities + block.Count, [&](uint32_t inIndex) { return inIndex >= header.EntityCount; })) {
+            MeowEngine::Log("Scene Serializer", inPath + " has entities out of range");
+            return false;
+        }
+
+        // ascending also means each entity has the component once
+        if(std::adjacent_find(entities, entities + block.Count, [](uint32_t inPrevious, uint32_t inNext) { return inPrevious >= inNext; }) != entities + block.Count) {
+            MeowEngine::Log("Scene Serializer", inPath + " has entities out of order");
+            return false;
+        }
+
+        const std::string_view componentName = ::GetString(block.ComponentName, strings);
+        const ComponentLoader* loader = FindLoader(block.ComponentType, componentName);
+
+        if(loader == nullptr) {
+            MeowEngine::Log("Scene Serializer", "Skipping " + std::string(componentName) + ", it has no prototype");
+            continue;
+        }
+
+        if(std::find(loaders.begin(), loaders.end(), loader) != loaders.end()) {
+            MeowEngine::Log("Scene Serializer", inPath + " has " + std::string(componentName) + " twice");
+            return false;
+        }
+
+        const std::vector<SceneField> fields = GetFields(loader->Type);
+        BlockLoad& load = blocks.emplace_back(BlockLoad{&block, entities, {}});
+
+        if(block.SchemaHash == GetSchemaHash(MeowEngine::Reflection.GetComponentName(loader->Type), fields) && block.RecordSize == ::GetRecordSize(fields)) {
+            load.Copies = ::GetMatchingCopies(fields);
+        }
+        else {
+            MeowEngine::Log("Scene Serializer", std::string(componentName) + " changed since it was saved, loading it field by field");
+            load.Copies = ::GetChangedCopies(fileFields, fields, strings);
+        }
+
+        loaders.push_back(loader);
+    }
+
+    const std::vector<entt::entity> entities = inBuffer.AddEntities(header.EntityCount);
+    std::vector<entt::entity> blockEntities;
+
+    for(std::size_t i = 0; i < blocks.size(); i++) {
+        const SceneBlockHeader& block = *blocks[i].Header;
+
+        blockEntities.resize(block.Count);
+        for(uint32_t j = 0; j < block.Count; j++) {
+            blockEntities[j] = entities[blocks[i].Entities[j]];
+        }
+
+        loaders[i]->LoadBlock(*loaders[i], inBuffer, blockEntities, {data + block.RecordsOffset, block.RecordSize, blocks[i].Copies, strings});
+    }
+
+    const auto loadTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime);
+    MeowEngine::Log("Scene Serializer", "Loaded " + std::to_string(entities.size()) + " entities from " + inPath + " in " + std::to_string(loadTime.count()) + " ms");
+
+    return true;
+}
+
+void MeowEngine::SceneSerializer::ReadRecord(std::byte* outComponent, const std::byte* inRecord, const SceneBlockData& inBlock) {
+    for(const SceneFieldCopy& copy : inBlock.Copies) {
+        if(copy.Kind == SceneFieldKind::Bytes) {
+            std::memcpy(outComponent + copy.ComponentOffset, inRecord + copy.RecordOffset, copy.Size);
+            continue;
+        }
+
+        SceneStringReference reference;
+        std::memcpy(&reference, inRecord + copy.RecordOffset, sizeof(reference));
+
+        // a bad reference leaves the prototype's string
+        if(::IsValidString(reference, inBlock.Strings)) {
+            auto& value = *reinterpret_cast<MeowEngine::PString*>(outComponent + copy.ComponentOffset);
+            value.assign(::GetString(reference, inBlock.Strings));
+        }
+    }
+}
+
+const MeowEngine::SceneSerializer::ComponentLoader* MeowEngine::SceneSerializer::FindLoader(entt::id_type inType, std::string_view inName) const {
+    for(const ComponentLoader& loader : Loaders) {
+        if(loader.Type == inType) {
+            return &loader;
+        }
+    }
+
+    // type hashes come from compiler specific names, files from another build match by reflected name
+    for(const ComponentLoader& loader : Loaders) {
+        if(MeowEngine::Reflection.GetComponentName(loader.Type) == inName) {
+            return &loader;
+        }
+    }
+
+    return nullptr;
+}
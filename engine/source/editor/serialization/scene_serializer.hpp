@@ -0,0 +1,127 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_SCENE_SERIALIZER_HPP
+#define MEOWENGINE_SCENE_SERIALIZER_HPP
+
+#include "entt_wrapper.hpp"
+#include "entt_buffer.hpp"
+#include "scene_file_format.hpp"
+#include "string"
+#include "string_view"
+#include "vector"
+#include "span"
+#include "memory"
+#include "cstdint"
+
+namespace MeowEngine {
+    /**
+     * Reflected leaf of a component, nested classes are flattened so fields still match by path after a schema change
+     */
+    struct SceneField {
+        std::string Path; // i.e. "Position.X"
+        std::string TypeName;
+        SceneFieldKind Kind;
+        uint32_t ComponentOffset;
+        uint32_t Size;
+        uint32_t RecordOffset;
+    };
+
+    /**
+     * Bytes copied from a record into a component, the fast path merges neighbouring fields into one copy
+     */
+    struct SceneFieldCopy {
+        SceneFieldKind Kind;
+        uint32_t RecordOffset;
+        uint32_t ComponentOffset;
+        uint32_t Size;
+    };
+
+    /**
+     * One component block read in place from the mapped file
+     */
+    struct SceneBlockData {
+        const std::byte* Records;
+        uint32_t RecordSize;
+        std::span<const SceneFieldCopy> Copies;
+        std::string_view Strings;
+    };
+
+    /**
+     * Saves & loads registries using reflection metadata, see scene_file_format.hpp for the layout.
+     * Components are written as one contiguous block per type & loaded block by block with a single bulk insert.
+     * Blocks whose schema hash still matches copy records with precomputed spans, changed ones match fields by path
+     * & type, fields missing from the file keep the prototype value.
+     */
+    class SceneSerializer {
+    public:
+        /**
+         * Loaded components start as copies of the prototype with serialized fields written over, members that aren't
+         * reflected (asset instances, physics bodies, caches) keep the prototype's value.
+         * Component has to be registered with reflection too.
+         */
+        template<typename ComponentType>
+        void RegisterComponent(const ComponentType& inPrototype);
+
+        /**
+         * Main thread. Writes every entity & every reflected component of the registry.
+         */
+        bool Save(const std::string& inPath, entt::registry& inRegistry) const;
+
+        /**
+         * Main thread. Adds the scene's entities to the buffer, nothing is added when the file is invalid.
+         * Components without a registered prototype are skipped.
+         */
+        bool Load(const std::string& inPath, MeowEngine::EnttBuffer& inBuffer) const;
+
+        /**
+         * Reflected leaves of a component in its current schema, records are packed in this order
+         */
+        static std::vector<SceneField> GetFields(entt::id_type inComponentType);
+
+        static uint64_t GetSchemaHash(std::string_view inComponentName, const std::vector<SceneField>& inFields);
+
+    private:
+        struct ComponentLoader {
+            entt::id_type Type;
+            std::shared_ptr<const void> Prototype;
+            void (*LoadBlock)(const ComponentLoader& inLoader, MeowEngine::EnttBuffer& inBuffer, std::span<const entt::entity> inEntities, const SceneBlockData& inBlock);
+        };
+
+        template<typename ComponentType>
+        static void LoadBlock(const ComponentLoader& inLoader, MeowEngine::EnttBuffer& inBuffer, std::span<const entt::entity> inEntities, const SceneBlockData& inBlock);
+
+        /**
+         * Writes one record over a component
+         */
+        static void ReadRecord(std::byte* outComponent, const std::byte* inRecord, const SceneBlockData& inBlock);
+
+        const ComponentLoader* FindLoader(entt::id_type inType, std::string_view inName) const;
+
+        std::vector<ComponentLoader> Loaders;
+    };
+
+    template<typename ComponentType>
+    void SceneSerializer::RegisterComponent(const ComponentType& inPrototype) {
+        Loaders.push_back({
+            entt::type_hash<ComponentType>::value(),
+            std::make_shared<const ComponentType>(inPrototype),
+            &SceneSerializer::LoadBlock<ComponentType>
+        });
+    }
+
+    template<typename ComponentType>
+    void SceneSerializer::LoadBlock(const ComponentLoader& inLoader, MeowEngine::EnttBuffer& inBuffer, std::span<const entt::entity> inEntities, const SceneBlockData& inBlock) {
+        const ComponentType& prototype = *static_cast<const ComponentType*>(inLoader.Prototype.get());
+        std::vector<ComponentType> values(inEntities.size(), prototype);
+
+        for(std::size_t i = 0; i < values.size(); i++) {
+            ReadRecord(reinterpret_cast<std::byte*>(std::addressof(values[i])), inBlock.Records + i * inBlock.RecordSize, inBlock);
+        }
+
+        inBuffer.AddComponents<ComponentType>(inEntities, values);
+    }
+}
+
+#endif //MEOWENGINE_SCENE_SERIALIZER_HPP
@@ -0,0 +1,64 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "frame_time_statistics.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <cstdio>
+
+MeowEngine::FrameTimeStatistics::FrameTimeStatistics(std::string inName, std::size_t inExpectedSampleCount)
+: Name(std::move(inName)) {
+    // reserve up front so sampling doesn't allocate mid frame
+    Samples.reserve(inExpectedSampleCount);
+}
+
+void MeowEngine::FrameTimeStatistics::AddSample(double inFrameTime) {
+    Samples.push_back(inFrameTime);
+}
+
+std::size_t MeowEngine::FrameTimeStatistics::GetSampleCount() const {
+    return Samples.size();
+}
+
+double MeowEngine::FrameTimeStatistics::GetMean() const {
+    if(Samples.empty()) {
+        return 0.0;
+    }
+
+    return std::accumulate(Samples.begin(), Samples.end(), 0.0) / static_cast<double>(Samples.size());
+}
+
+double MeowEngine::FrameTimeStatistics::GetPercentile(double inPercentile) const {
+    if(Samples.empty()) {
+        return 0.0;
+    }
+
+    std::vector<double> sorted = Samples;
+    const std::size_t index = std::min(
+        static_cast<std::size_t>(inPercentile / 100.0 * static_cast<double>(sorted.size())),
+        sorted.size() - 1
+    );
+    std::nth_element(sorted.begin(), sorted.begin() + static_cast<long>(index), sorted.end());
+
+    return sorted[index];
+}
+
+void MeowEngine::FrameTimeStatistics::Print() const {
+    if(Samples.empty()) {
+        std::printf("%-16s no samples\n", Name.c_str());
+        return;
+    }
+
+    const auto [minimum, maximum] = std::minmax_element(Samples.begin(), Samples.end());
+
+    std::printf("%-16s frames %6zu | min %8.3fms | mean %8.3fms | p50 %8.3fms | p99 %8.3fms | max %8.3fms\n",
+                Name.c_str(),
+                Samples.size(),
+                *minimum * 1000.0,
+                GetMean() * 1000.0,
+                GetPercentile(50.0) * 1000.0,
+                GetPercentile(99.0) * 1000.0,
+                *maximum * 1000.0);
+}
@@ -0,0 +1,40 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_FRAME_TIME_STATISTICS_HPP
+#define MEOWENGINE_FRAME_TIME_STATISTICS_HPP
+
+#include "string"
+#include "vector"
+
+namespace MeowEngine {
+    /**
+     * Collects frame times of a single thread & reports min / mean / percentiles / max.
+     * Samples are only written by the owning thread, read once the thread is done.
+     */
+    class FrameTimeStatistics {
+    public:
+        explicit FrameTimeStatistics(std::string inName, std::size_t inExpectedSampleCount = 1024);
+
+        /**
+         * @param inFrameTime in seconds
+         */
+        void AddSample(double inFrameTime);
+
+        std::size_t GetSampleCount() const;
+        double GetMean() const;
+        double GetPercentile(double inPercentile) const;
+
+        /**
+         * Prints to stdout even in release builds, this is used by automated perf runs
+         */
+        void Print() const;
+
+    private:
+        std::string Name;
+        std::vector<double> Samples;
+    };
+}
+
+#endif //MEOWENGINE_FRAME_TIME_STATISTICS_HPP
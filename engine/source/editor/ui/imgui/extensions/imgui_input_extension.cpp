@@ -8,10 +8,20 @@
 
 #include "pstring.hpp"
 #include "vector3.hpp"
+#include "math_wrapper.hpp"
 
-MeowEngine::ReflectionPropertyChange* MeowEngine::ImGuiInputExtension::ShowProperty(const std::string& inClassName, void* inObject) {
-    std::vector<MeowEngine::ReflectionProperty> properties = MeowEngine::Reflection.GetProperties(inClassName);
-    MeowEngine::ReflectionPropertyChange* change = nullptr;
+namespace {
+    // keeps the last edited property when several are edited in one frame, others go back to the pool
+    void AssignChange(MeowEngine::PropertyChangePtr& inTarget, MeowEngine::PropertyChangePtr inValue) {
+        if(inValue != nullptr) {
+            inTarget = std::move(inValue);
+        }
+    }
+}
+
+MeowEngine::PropertyChangePtr MeowEngine::ImGuiInputExtension::ShowProperty(entt::id_type inClassId, void* inObject) {
+    std::span<const MeowEngine::ReflectionProperty> properties = MeowEngine::Reflection.GetProperties(inClassId);
+    MeowEngine::PropertyChangePtr change;
 
     // Display Component Properties
     for (const auto &property: properties) {
@@ -20,7 +30,7 @@ MeowEngine::ReflectionPropertyChange* MeowEngine::ImGuiInputExtension::ShowPrope
                 break;
             case MeowEngine::PRIMITIVE: {
                 ImGui::Indent();
-                MeowEngine::ReflectionPropertyChange::Assign(change, ImGuiInputExtension::ShowPrimitive(property, inObject));
+                AssignChange(change, ImGuiInputExtension::ShowPrimitive(property, inObject));
                 ImGui::Unindent();
                 break;
             }
@@ -32,7 +42,7 @@ MeowEngine::ReflectionPropertyChange* MeowEngine::ImGuiInputExtension::ShowPrope
                 break;
             case MeowEngine::CLASS_OR_STRUCT: {
                 ImGui::Indent();
-                MeowEngine::ReflectionPropertyChange::Assign(change, ImGuiInputExtension::ShowClassOrStruct(property, inObject));
+                AssignChange(change, ImGuiInputExtension::ShowClassOrStruct(property, inObject));
                 ImGui::Unindent();
                 break;
             }
@@ -42,8 +52,8 @@ MeowEngine::ReflectionPropertyChange* MeowEngine::ImGuiInputExtension::ShowPrope
     return change;
 }
 
-MeowEngine::ReflectionPropertyChange* MeowEngine::ImGuiInputExtension::ShowPrimitive(const MeowEngine::ReflectionProperty& inProperty, void* inObject) {
-    MeowEngine::ReflectionPropertyChange* change = nullptr;
+MeowEngine::PropertyChangePtr MeowEngine::ImGuiInputExtension::ShowPrimitive(const MeowEngine::ReflectionProperty& inProperty, void* inObject) {
+    MeowEngine::PropertyChangePtr change;
 
     if(inProperty.TypeId == typeid(int)) {
         void* value = inProperty.Get(inObject);
@@ -58,7 +68,9 @@ MeowEngine::ReflectionPropertyChange* MeowEngine::ImGuiInputExtension::ShowPrimi
         ImGui::SetCursorPosX(200);
 
         if(ImGui::InputScalar(labelName.c_str(), ImGuiDataType_U32, &changeHolder, nullptr, nullptr, nullptr, ImGuiInputTextFlags_EnterReturnsTrue)) {
-            change = new MeowEngine::ReflectionPropertyChange(inProperty.Name, new int(changeHolder), [](void* inPointer){ delete static_cast<int*>(inPointer); });
+            change = MeowEngine::PropertyChangePool::Get().Acquire();
+            change->SetValue(changeHolder);
+            change->PushOuterProperty(inProperty.Index);
         }
     }
     else if(inProperty.TypeId == typeid(float)) {
@@ -74,15 +86,17 @@ MeowEngine::ReflectionPropertyChange* MeowEngine::ImGuiInputExtension::ShowPrimi
         ImGui::SetCursorPosX(200);
 
         if(ImGui::InputScalar(labelName.c_str(), ImGuiDataType_Float, &changeHolder, nullptr, nullptr, nullptr, ImGuiInputTextFlags_EnterReturnsTrue)) {
-            change = new MeowEngine::ReflectionPropertyChange(inProperty.Name, new float(changeHolder), [](void* inPointer){ delete static_cast<float*>(inPointer); });
+            change = MeowEngine::PropertyChangePool::Get().Acquire();
+            change->SetValue(changeHolder);
+            change->PushOuterProperty(inProperty.Index);
         }
     }
 
     return change;
 }
 
-MeowEngine::ReflectionPropertyChange* MeowEngine::ImGuiInputExtension::ShowClassOrStruct(const MeowEngine::ReflectionProperty& inProperty, void* inObject) {
-    MeowEngine::ReflectionPropertyChange* change = nullptr;
+MeowEngine::PropertyChangePtr MeowEngine::ImGuiInputExtension::ShowClassOrStruct(const MeowEngine::ReflectionProperty& inProperty, void* inObject) {
+    MeowEngine::PropertyChangePtr change;
 
     if(inProperty.TypeId == typeid(MeowEngine::PString)) {
         void* value = inProperty.Get(inObject);
@@ -97,7 +111,9 @@ MeowEngine::ReflectionPropertyChange* MeowEngine::ImGuiInputExtension::ShowClass
         ImGui::SetCursorPosX(200);
 
         if(ImGui::InputText(labelName.c_str(), changeHolder.data(), 32, ImGuiInputTextFlags_EnterReturnsTrue)) {
-            change = new MeowEngine::ReflectionPropertyChange(inProperty.Name, new MeowEngine::PString(changeHolder), [](void* inPointer){ delete static_cast<MeowEngine::PString*>(inPointer); });
+            change = MeowEngine::PropertyChangePool::Get().Acquire();
+            change->SetValue(changeHolder);
+            change->PushOuterProperty(inProperty.Index);
         }
     }
     else if(inProperty.TypeId == typeid(MeowEngine::math::Vector3)) {
@@ -113,17 +129,38 @@ MeowEngine::ReflectionPropertyChange* MeowEngine::ImGuiInputExtension::ShowClass
         ImGui::SetCursorPosX(200);
 
         if(ImGui::InputFloat3(labelName.c_str(), &changeHolder[0], nullptr, ImGuiInputTextFlags_EnterReturnsTrue)) {
-            change = new MeowEngine::ReflectionPropertyChange(inProperty.Name, new MeowEngine::math::Vector3(changeHolder), [](void* inPointer){ delete static_cast<MeowEngine::math::Vector3*>(inPointer); });
+            change = MeowEngine::PropertyChangePool::Get().Acquire();
+            change->SetValue(changeHolder);
+            change->PushOuterProperty(inProperty.Index);
+        }
+    }
+    else if(inProperty.TypeId == typeid(glm::vec3)) {
+        void* value = inProperty.Get(inObject);
+        glm::vec3 changeHolder = *static_cast<glm::vec3*>(value);
+        auto uniqueId = reinterpret_cast<uintptr_t>(value);
+
+        std::string labelName = MeowEngine::PString::Format("##%s", inProperty.Name.c_str(), std::to_string(uniqueId).c_str());
+
+        ImGui::AlignTextToFramePadding();
+        ImGui::Text("%s", inProperty.Name.c_str());
+        ImGui::SameLine();
+        ImGui::SetCursorPosX(200);
+
+        if(ImGui::InputFloat3(labelName.c_str(), &changeHolder[0], nullptr, ImGuiInputTextFlags_EnterReturnsTrue)) {
+            change = MeowEngine::PropertyChangePool::Get().Acquire();
+            change->SetValue(changeHolder);
+            change->PushOuterProperty(inProperty.Index);
         }
     }
     else {
         ImGui::SetNextItemOpen(true, ImGuiCond_Once);
 
         if(ImGui::TreeNode(inProperty.Name.c_str())) {
-            MeowEngine::ReflectionPropertyChange::Assign(change, ShowProperty(inProperty.TypeName, inProperty.Get(inObject)));
+            AssignChange(change, ShowProperty(inProperty.TypeHash, inProperty.Get(inObject)));
 
-            if(change != nullptr) {
-                change->ClassProperties.push_back(inProperty);
+            // paths deeper than a change can hold are dropped, nothing else would know where to apply them
+            if(change != nullptr && !change->PushOuterProperty(inProperty.Index)) {
+                change.reset();
             }
 
             ImGui::TreePop();
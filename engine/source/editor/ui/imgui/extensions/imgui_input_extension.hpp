@@ -6,17 +6,18 @@
 #define MEOWENGINE_IMGUI_INPUT_EXTENSION_HPP
 
 #include "string"
+#include "entt_wrapper.hpp"
 #include "reflection_property.hpp"
-#include "reflection_property_change.hpp"
+#include "property_change_pool.hpp"
 
 using namespace std;
 
 namespace MeowEngine {
     class ImGuiInputExtension {
     public:
-        static MeowEngine::ReflectionPropertyChange* ShowProperty(const std::string& inClassName, void* inObject);
-        static MeowEngine::ReflectionPropertyChange* ShowPrimitive(const MeowEngine::ReflectionProperty& inProperty, void* inObject);
-        static MeowEngine::ReflectionPropertyChange* ShowClassOrStruct(const MeowEngine::ReflectionProperty& inProperty, void* inObject);
+        static MeowEngine::PropertyChangePtr ShowProperty(entt::id_type inClassId, void* inObject);
+        static MeowEngine::PropertyChangePtr ShowPrimitive(const MeowEngine::ReflectionProperty& inProperty, void* inObject);
+        static MeowEngine::PropertyChangePtr ShowClassOrStruct(const MeowEngine::ReflectionProperty& inProperty, void* inObject);
 
         static void ShowTabExample();
         static void ShowPushItemWidthExample();
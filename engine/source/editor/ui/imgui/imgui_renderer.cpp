@@ -107,7 +107,7 @@ void ImGuiRenderer::Input(const SDL_Event& event) {
 #endif
 }
 
-void MeowEngine::graphics::ImGuiRenderer::Render(entt::registry& registry, std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& inUIInputQueue, unsigned int frameBufferId, const double fps) {
+void MeowEngine::graphics::ImGuiRenderer::Render(entt::registry& registry, MeowEngine::PropertyChangeQueue& inUIInputQueue, unsigned int frameBufferId, const double fps) {
     CreateNewFrame();
     DrawFrame(registry, inUIInputQueue, frameBufferId, fps);
     RenderFrame();
@@ -117,6 +117,10 @@ void ImGuiRenderer::ClosePIDs() {
     ::HandleTracyProfilerSignal(SIGQUIT);
 }
 
+void ImGuiRenderer::SetSceneViewportCallbacks(std::function<void(MeowEngine::WindowSize)> inOnResized, std::function<void(bool)> inOnFocusChanged) {
+    WorldRenderPanel.SetCallbacks(std::move(inOnResized), std::move(inOnFocusChanged));
+}
+
 //bool MeowEngine::graphics::ImGuiRenderer::IsSceneViewportFocused() const {
 //    return isSceneViewportFocused;
 //}
@@ -154,7 +158,7 @@ void MeowEngine::graphics::ImGuiRenderer::CreateNewFrame() {
     ImGui::NewFrame();
 }
 
-void MeowEngine::graphics::ImGuiRenderer::DrawFrame(entt::registry& registry, std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& inUIInputQueue, uint32_t frameBufferId, const double fps) {
+void MeowEngine::graphics::ImGuiRenderer::DrawFrame(entt::registry& registry, MeowEngine::PropertyChangeQueue& inUIInputQueue, uint32_t frameBufferId, const double fps) {
     CreateDockingSpace();
 
 //    CreateRender3DPanel(frameBufferId);
@@ -14,7 +14,7 @@
 #include "imgui_world_render_panel.hpp"
 #include "imgui_log_panel.hpp"
 #include "entt_wrapper.hpp"
-#include "queue"
+#include "property_change_queue.hpp"
 
 namespace MeowEngine::graphics {
     struct ImGuiRenderer {
@@ -22,11 +22,16 @@ namespace MeowEngine::graphics {
         ~ImGuiRenderer();
 
         void Input(const SDL_Event& event);
-        void Render(entt::registry& registry, std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& inUIInputQueue, unsigned int frameBufferId, const double fps);
+        void Render(entt::registry& registry, MeowEngine::PropertyChangeQueue& inUIInputQueue, unsigned int frameBufferId, const double fps);
 
         // Closes any child processes like tracy
         void ClosePIDs();
 
+        /**
+         * Scene panel resize / focus changes, called on render thread during Render
+         */
+        void SetSceneViewportCallbacks(std::function<void(MeowEngine::WindowSize)> inOnResized, std::function<void(bool)> inOnFocusChanged);
+
 //        bool IsSceneViewportFocused() const;
 //        const WindowSize& GetSceneViewportSize() const;
 
@@ -34,7 +39,7 @@ namespace MeowEngine::graphics {
         void OpenTracyProfiler();
 
         void CreateNewFrame();
-        void DrawFrame(entt::registry& registry, std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& inUIInputQueue, uint32_t frameBufferId, const double fps);
+        void DrawFrame(entt::registry& registry, MeowEngine::PropertyChangeQueue& inUIInputQueue, uint32_t frameBufferId, const double fps);
         void RenderFrame();
 
         void CreateDockingSpace();
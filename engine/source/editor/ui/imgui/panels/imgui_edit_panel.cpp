@@ -17,7 +17,7 @@ MeowEngine::graphics::ui::ImGuiEditPanel::~ImGuiEditPanel() {
 
 }
 
-void MeowEngine::graphics::ui::ImGuiEditPanel::Draw(entt::registry& registry, std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& inUIInputQueue, entt::entity lifeObject) {
+void MeowEngine::graphics::ui::ImGuiEditPanel::Draw(entt::registry& registry, MeowEngine::PropertyChangeQueue& inUIInputQueue, entt::entity lifeObject) {
     ImGuiWindowFlags window_flags = 0;
     window_flags |= ImGuiWindowFlags_NoCollapse;
 
@@ -30,20 +30,20 @@ void MeowEngine::graphics::ui::ImGuiEditPanel::Draw(entt::registry& registry, st
             for(pair<unsigned int, entt::basic_sparse_set<>&> component : registry.storage()){
                 if(component.second.contains(lifeObject)) {
                     entt::id_type type = component.first;
-                    const std::string componentName = MeowEngine::Reflection.GetComponentName(type);
+                    const std::string& componentName = MeowEngine::Reflection.GetComponentName(type);
                     void* componentObject = component.second.value(lifeObject);
 
                     // Display Component Name
                     if(ImGui::CollapsingHeader(componentName.c_str(), ImGuiTreeNodeFlags_DefaultOpen)) {
                         if(
-                            MeowEngine::ReflectionPropertyChange* change = MeowEngine::ImGuiInputExtension::ShowProperty(componentName, componentObject);
+                            MeowEngine::PropertyChangePtr change = MeowEngine::ImGuiInputExtension::ShowProperty(type, componentObject);
                             change != nullptr
                         ){
                             change->EntityId = static_cast<int>(lifeObject);
                             change->ComponentType = type;
+                            change->PathId = MeowEngine::Reflection.InternPropertyPath(type, change->GetPropertyIndices());
 
-//                            MeowEngine::Log("Edit Panel", *static_cast<float*>(change->Data));
-                            inUIInputQueue.push(std::make_shared<MeowEngine::ReflectionPropertyChange>(*change));
+                            inUIInputQueue.Push(std::move(change));
                         }
 
                         ImGui::Spacing();
@@ -80,6 +80,11 @@ void MeowEngine::graphics::ui::ImGuiEditPanel::Draw(entt::registry& registry, st
             MeowEngine::Log("Selected Entity: ", "Entity not valid");
         }
 
+        ImGui::Separator();
+        ImGui::TextDisabled("Edits %llu, coalesced %llu",
+                            static_cast<unsigned long long>(inUIInputQueue.GetPushedCount()),
+                            static_cast<unsigned long long>(inUIInputQueue.GetCoalescedCount()));
+
         ImGui::End();
     }
 }
@@ -9,14 +9,14 @@
 //#include "scene.hpp"
 #include "entt_wrapper.hpp"
 #include "reflection_property_change.hpp"
-#include "queue"
+#include "property_change_queue.hpp"
 
 namespace MeowEngine::graphics::ui {
     struct ImGuiEditPanel {
         ImGuiEditPanel();
         ~ImGuiEditPanel();
 
-        void Draw(entt::registry& registry, std::queue<std::shared_ptr<MeowEngine::ReflectionPropertyChange>>& inUIInputQueue, entt::entity lifeObject);
+        void Draw(entt::registry& registry, MeowEngine::PropertyChangeQueue& inUIInputQueue, entt::entity lifeObject);
 
     private:
         bool CanDrawPanel;
@@ -6,7 +6,6 @@
 
 #include "log.hpp"
 #include "window_size.hpp"
-#include <SDL_events.h>
 
 using MeowEngine::editor::ImGuiWorldRenderPanel;
 
@@ -21,6 +20,11 @@ ImGuiWorldRenderPanel::~ImGuiWorldRenderPanel() {
     PT_PROFILE_FREE("ImGuiWorldRenderPanel");
 }
 
+void ImGuiWorldRenderPanel::SetCallbacks(std::function<void(MeowEngine::WindowSize)> inOnResized, std::function<void(bool)> inOnFocusChanged) {
+    OnResized = std::move(inOnResized);
+    OnFocusChanged = std::move(inOnFocusChanged);
+}
+
 void ImGuiWorldRenderPanel::Draw(void* frameBufferId, const float& inFps) {
 
     ImGui::Begin("Scene", &IsActive,WindowFlags); {
@@ -28,13 +32,9 @@ void ImGuiWorldRenderPanel::Draw(void* frameBufferId, const float& inFps) {
         if(isFocused != IsFocused) {
             IsFocused = isFocused;
 
-            SDL_Event event;
-            SDL_zero(event);
-            event.type = SDL_USEREVENT;
-            event.user.code = 3;
-            event.user.data1 = &IsFocused;
-
-            SDL_PushEvent(&event);
+            if(OnFocusChanged) {
+                OnFocusChanged(IsFocused);
+            }
         }
 
         ImGui::BeginChild("GameRender");
@@ -44,13 +44,9 @@ void ImGuiWorldRenderPanel::Draw(void* frameBufferId, const float& inFps) {
             SceneViewportSize.Width = (uint32_t)viewportSize.x;
             SceneViewportSize.Height = (uint32_t)viewportSize.y;
 
-            SDL_Event event;
-            SDL_zero(event);
-            event.type = SDL_USEREVENT;
-            event.user.code = 2;
-            event.user.data1 = &SceneViewportSize;
-
-            SDL_PushEvent(&event);
+            if(OnResized) {
+                OnResized(SceneViewportSize);
+            }
         }
 
         ImGui::Image(
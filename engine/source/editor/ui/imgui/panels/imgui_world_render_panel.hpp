@@ -7,6 +7,7 @@
 
 #include "imgui_wrapper.hpp"
 #include "window_size.hpp"
+#include "functional"
 
 namespace MeowEngine::editor {
 
@@ -16,6 +17,11 @@ namespace MeowEngine::editor {
 
         void Draw(void* frameBufferId, const float& inFps);
 
+        /**
+         * Called on render thread while drawing, values are passed by copy so receivers can hand them to other threads
+         */
+        void SetCallbacks(std::function<void(MeowEngine::WindowSize)> inOnResized, std::function<void(bool)> inOnFocusChanged);
+
     private:
         bool IsActive;
         bool IsFocused; // soon come up with good naming conventions
@@ -23,6 +29,9 @@ namespace MeowEngine::editor {
 //        int LastFPS;
 
         WindowSize SceneViewportSize;
+
+        std::function<void(MeowEngine::WindowSize)> OnResized;
+        std::function<void(bool)> OnFocusChanged;
     };
 }
 
@@ -0,0 +1,37 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "frame_pacing.hpp"
+
+const char* MeowEngine::GetFramePacingPolicyName(FramePacingPolicy inPolicy) {
+    switch (inPolicy) {
+        case FramePacingPolicy::Spin:
+            return "spin";
+        case FramePacingPolicy::Sleep:
+            return "sleep";
+        case FramePacingPolicy::Hybrid:
+            return "hybrid";
+    }
+
+    return "unknown";
+}
+
+bool MeowEngine::TryParseFramePacingPolicy(const std::string& inName, FramePacingPolicy& outPolicy) {
+    if(inName == "spin") {
+        outPolicy = FramePacingPolicy::Spin;
+        return true;
+    }
+
+    if(inName == "sleep") {
+        outPolicy = FramePacingPolicy::Sleep;
+        return true;
+    }
+
+    if(inName == "hybrid") {
+        outPolicy = FramePacingPolicy::Hybrid;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,38 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_FRAME_PACING_HPP
+#define MEOWENGINE_FRAME_PACING_HPP
+
+#include "string"
+
+namespace MeowEngine {
+    /**
+     * How a thread waits out the rest of its frame
+     *  Spin    - busy waits on performance counter, tightest timing but burns a full core
+     *  Sleep   - sleeps for the remaining time, cheapest but overshoots by os scheduler granularity
+     *  Hybrid  - sleeps for the bulk of remaining time & spins only for a calibrated final slice
+     */
+    enum class FramePacingPolicy {
+        Spin,
+        Sleep,
+        Hybrid
+    };
+
+    /**
+     * Overshoot past target frame time, in seconds
+     */
+    struct FramePacingStatistics {
+        double MeanOvershoot = 0.0;
+        double P99Overshoot = 0.0;
+        double MaxOvershoot = 0.0;
+        double SpinSlice = 0.0;
+        size_t SampleCount = 0;
+    };
+
+    const char* GetFramePacingPolicyName(FramePacingPolicy inPolicy);
+    bool TryParseFramePacingPolicy(const std::string& inName, FramePacingPolicy& outPolicy);
+}
+
+#endif //MEOWENGINE_FRAME_PACING_HPP
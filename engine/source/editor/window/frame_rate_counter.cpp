@@ -3,3 +3,97 @@
 //
 
 #include "frame_rate_counter.hpp"
+
+#include "algorithm"
+#include "chrono"
+#include "thread"
+
+void FrameRateCounter::LockFrameRate() {
+    // frames that already ran past target are work overruns, not pacing jitter
+    const bool isFrameLate = GetElapsedTime() >= targetFrameTime;
+
+    switch (pacingPolicy) {
+        case MeowEngine::FramePacingPolicy::Spin:
+            SpinUntil(targetFrameTime);
+            break;
+        case MeowEngine::FramePacingPolicy::Sleep:
+            SleepUntil(targetFrameTime);
+            break;
+        case MeowEngine::FramePacingPolicy::Hybrid:
+            SleepUntil(targetFrameTime - spinSlice);
+            SpinUntil(targetFrameTime);
+            break;
+    }
+
+    const Uint64 frameEndTime = SDL_GetPerformanceCounter();
+    const double overshoot = (double) (frameEndTime - frameStartTime) / frequency - targetFrameTime;
+
+    if(!isFrameLate) {
+        overshoots[overshootIndex] = overshoot;
+        overshootIndex = (overshootIndex + 1) % overshootSampleSize;
+        overshootCount = std::min(overshootCount + 1, overshootSampleSize);
+    }
+
+    previousTime = frameEndTime;
+}
+
+MeowEngine::FramePacingStatistics FrameRateCounter::GetPacingStatistics() const {
+    MeowEngine::FramePacingStatistics statistics;
+    statistics.SpinSlice = spinSlice;
+    statistics.SampleCount = overshootCount;
+
+    if(overshootCount == 0) {
+        return statistics;
+    }
+
+    std::vector<double> sorted(overshoots.begin(), overshoots.begin() + overshootCount);
+    std::sort(sorted.begin(), sorted.end());
+
+    double total = 0.0;
+    for(const double overshoot : sorted) {
+        total += overshoot;
+    }
+
+    statistics.MeanOvershoot = total / overshootCount;
+    statistics.P99Overshoot = sorted[std::min(overshootCount - 1, (size_t)(overshootCount * 0.99))];
+    statistics.MaxOvershoot = sorted.back();
+
+    return statistics;
+}
+
+double FrameRateCounter::GetElapsedTime() const {
+    return (double) (SDL_GetPerformanceCounter() - frameStartTime) / frequency;
+}
+
+void FrameRateCounter::SpinUntil(double inFrameTime) const {
+    while (GetElapsedTime() < inFrameTime) {
+    }
+}
+
+void FrameRateCounter::SleepUntil(double inFrameTime) {
+    const double remainingTime = inFrameTime - GetElapsedTime();
+
+    if(remainingTime <= 0.0) {
+        return;
+    }
+
+    const Uint64 sleepStartTime = SDL_GetPerformanceCounter();
+    std::this_thread::sleep_for(std::chrono::duration<double>(remainingTime));
+    const double sleptTime = (double) (SDL_GetPerformanceCounter() - sleepStartTime) / frequency;
+
+    if(pacingPolicy == MeowEngine::FramePacingPolicy::Hybrid) {
+        CalibrateSpinSlice(sleptTime - remainingTime);
+    }
+}
+
+void FrameRateCounter::CalibrateSpinSlice(double inOversleep) {
+    // grow straight away so next frame doesn't miss again, shrink slowly so one quiet frame doesn't undo it
+    if(inOversleep > spinSlice) {
+        spinSlice = inOversleep;
+    }
+    else {
+        spinSlice += (inOversleep - spinSlice) * 0.01;
+    }
+
+    spinSlice = std::clamp(spinSlice, minSpinSlice, maxSpinSlice);
+}
@@ -7,18 +7,24 @@
 
 #include "vector"
 #include "sdl_wrapper.hpp"
+#include "frame_pacing.hpp"
 
 // NOTE: Revisit on this
 class FrameRateCounter {
 public:
-    FrameRateCounter(float inFrameRate, int sampleSize = 100)
+    FrameRateCounter(float inFrameRate, int sampleSize = 100, MeowEngine::FramePacingPolicy inPacingPolicy = MeowEngine::FramePacingPolicy::Hybrid)
             : frameStartTime(SDL_GetPerformanceCounter())
             , targetFrameTime(1/inFrameRate)
             , sampleSize(sampleSize),
             frameTimes(sampleSize),
             currentIndex(0),
             accumulatedTime(0.0),
-              DeltaTime(0.0)
+              DeltaTime(0.0),
+            pacingPolicy(inPacingPolicy),
+            spinSlice(initialSpinSlice),
+            overshoots(overshootSampleSize),
+            overshootIndex(0),
+            overshootCount(0)
             {}
 
     void Calculate() {
@@ -39,18 +45,36 @@ public:
         frameStartTime = SDL_GetPerformanceCounter();
     }
 
-    void LockFrameRate() {
-        Uint64 frameEndTime = SDL_GetPerformanceCounter();
-        double frameDuration = (double) (frameEndTime - frameStartTime) / frequency;
+    /**
+     * Whether target frame time has passed since last Calculate, used when frames are scheduled instead of locked
+     */
+    bool IsFrameDue() const {
+        return (double)(SDL_GetPerformanceCounter() - frameStartTime) / frequency >= targetFrameTime;
+    }
 
-        while (frameDuration < targetFrameTime) {
-            frameEndTime = SDL_GetPerformanceCounter();
-            frameDuration = (double) (frameEndTime - frameStartTime) / frequency;
-        }
+    /**
+     * Waits until target frame time has passed since last Calculate, using the selected pacing policy
+     */
+    void LockFrameRate();
+
+    void SetPacingPolicy(MeowEngine::FramePacingPolicy inPacingPolicy) {
+        pacingPolicy = inPacingPolicy;
+    }
 
-        previousTime = frameEndTime;
+    MeowEngine::FramePacingPolicy GetPacingPolicy() const {
+        return pacingPolicy;
     }
 
+    /**
+     * Overshoot statistics over the last locked frames
+     */
+    MeowEngine::FramePacingStatistics GetPacingStatistics() const;
+
+    /**
+     * Seconds since last Calculate
+     */
+    double GetElapsedTime() const;
+
     double GetFrameRate() const {
         double averageFrameTime = accumulatedTime / sampleSize;
         return averageFrameTime > 0.0 ? 1.0 / averageFrameTime : 0.0;
@@ -69,6 +93,22 @@ private:
     Uint64 frequency = SDL_GetPerformanceFrequency();
     Uint64 previousTime = SDL_GetPerformanceCounter();
 
+    // for pacing
+    MeowEngine::FramePacingPolicy pacingPolicy;
+    double spinSlice; // calibrated from observed oversleep, only used by hybrid
+    std::vector<double> overshoots;
+    size_t overshootIndex;
+    size_t overshootCount;
+
+    static constexpr double initialSpinSlice = 0.002;
+    static constexpr double minSpinSlice = 0.0002;
+    static constexpr double maxSpinSlice = 0.004;
+    static constexpr size_t overshootSampleSize = 256;
+
+    void SpinUntil(double inFrameTime) const;
+    void SleepUntil(double inFrameTime);
+    void CalibrateSpinSlice(double inOversleep);
+
     // for delta time
 //    const float FramePerSecond; FramePerSecond(static_cast<float>(SDL_GetPerformanceFrequency())
 
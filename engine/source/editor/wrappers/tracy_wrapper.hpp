@@ -10,6 +10,8 @@
 //#include <TracyOpenCL.hpp>
 //#include "../../../../../../third-party/tracy/public/common/TracySystem.hpp"
 
+// TRACY_ENABLE comes with the TracyClient target, targets built without it (headless benchmarks) don't need tracy at all
+#ifdef TRACY_ENABLE
 #include "Tracy.hpp"
 #include "TracyC.h"
 #include <TracyOpenGL.hpp>
@@ -21,6 +23,14 @@
 #define PT_PROFILE_SCOPE_N(x) ZoneScopedN(x)
 #define PT_PROFILE_ALLOC(p, size) TracyCAllocS(p, size, 12);
 #define PT_PROFILE_FREE(p) TracyCFreeS(p, 12);
+#define PT_PROFILE_THREAD_NAME(name) tracy::SetThreadName(name)
+#else
+#define PT_PROFILE_SCOPE
+#define PT_PROFILE_SCOPE_N(x)
+#define PT_PROFILE_ALLOC(p, size)
+#define PT_PROFILE_FREE(p)
+#define PT_PROFILE_THREAD_NAME(name)
+#endif
 
 //        TracyGpuContext
 //        TracyMessageL("Sleep a little bit");
@@ -19,8 +19,11 @@ using MeowEngine::Engine;
 
 struct Engine::Internal {
     const std::string classLogTag;
+    const MeowEngine::ApplicationSettings Settings;
 
-    Internal() : classLogTag("MeowEngine::Engine::") {}
+    Internal(const MeowEngine::ApplicationSettings& inSettings)
+    : classLogTag("MeowEngine::Engine::")
+    , Settings(inSettings) {}
 
     void Run() {
         PT_PROFILE_SCOPE;
@@ -49,7 +52,7 @@ struct Engine::Internal {
         try {
             MeowEngine::Log(logTag, "Creating OpenGL Application...");
 //            return std::make_unique<MeowEngine::OpenGLApplication>();
-            return std::make_unique<MeowEngine::ApplicationTest>();
+            return std::make_unique<MeowEngine::ApplicationTest>(Settings);
         }
         catch (const std::exception& error) {
             MeowEngine::Log(logTag, "OpenGL Application failed to initialized.", error);
@@ -63,7 +66,9 @@ struct Engine::Internal {
     }
 };
 
-Engine::Engine() : InternalPointer(MeowEngine::make_internal_ptr<Internal>()) {}
+Engine::Engine() : InternalPointer(MeowEngine::make_internal_ptr<Internal>(MeowEngine::ApplicationSettings())) {}
+
+Engine::Engine(const MeowEngine::ApplicationSettings& inSettings) : InternalPointer(MeowEngine::make_internal_ptr<Internal>(inSettings)) {}
 
 void Engine::Run() {
     InternalPointer->Run();
@@ -8,10 +8,12 @@
 #pragma once
 
 #include "internal_ptr.hpp"
+#include "application_settings.hpp"
 
 namespace MeowEngine {
     struct Engine {
         Engine();
+        Engine(const MeowEngine::ApplicationSettings& inSettings);
 
         void Run()  ;
 
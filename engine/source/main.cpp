@@ -3,9 +3,19 @@
 //
 
 #include "engine.hpp"
+#include "job_system_benchmark.hpp"
+#include "application_settings.hpp"
 
-int main(int, char* []) {
-    MeowEngine::Engine().Run();
+int main(int argc, char* argv[]) {
+    const MeowEngine::ApplicationSettings settings = MeowEngine::ApplicationSettings::Parse(argc, argv);
+
+    // worker scaling benchmark, no window / gl context is created
+    if(settings.ShouldRunJobBenchmark) {
+        MeowEngine::JobSystemBenchmark::RunScalingBenchmark();
+        return 0;
+    }
+
+    MeowEngine::Engine(settings).Run();
 
     return 0;
-}
\ No newline at end of file
+}
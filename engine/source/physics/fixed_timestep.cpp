@@ -0,0 +1,30 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#include "fixed_timestep.hpp"
+
+#include "algorithm"
+
+MeowEngine::simulator::FixedTimestep::FixedTimestep(float inStepTime, int inMaxSubstepCount)
+    : StepTime(inStepTime)
+    , MaxSubstepCount(std::max(inMaxSubstepCount, 1))
+    , Accumulator(0.0)
+    , DroppedStepCount(0) {}
+
+int MeowEngine::simulator::FixedTimestep::Advance(float inFrameTime) {
+    Accumulator += std::max(inFrameTime, 0.0f);
+
+    const int availableStepCount = static_cast<int>(Accumulator / StepTime);
+    const int stepCount = std::min(availableStepCount, MaxSubstepCount);
+
+    // whole steps past the clamp are dropped, fractional part is kept so interpolation doesn't snap
+    Accumulator -= availableStepCount * static_cast<double>(StepTime);
+    DroppedStepCount += availableStepCount - stepCount;
+
+    return stepCount;
+}
+
+float MeowEngine::simulator::FixedTimestep::GetAlpha(float inPendingTime) const {
+    return std::clamp(static_cast<float>((Accumulator + inPendingTime) / StepTime), 0.0f, 1.0f);
+}
@@ -0,0 +1,49 @@
+//
+// Created by Akira Mujawar on 17/10/26.
+//
+
+#ifndef MEOWENGINE_FIXED_TIMESTEP_HPP
+#define MEOWENGINE_FIXED_TIMESTEP_HPP
+
+#include "cstdint"
+
+namespace MeowEngine::simulator {
+    /**
+     * Accumulates frame time & hands it out as whole fixed steps, so physics never sees a variable step.
+     * Leftover time is carried to next frame & exposed as interpolation alpha between the last two physics poses.
+     */
+    class FixedTimestep {
+    public:
+        FixedTimestep(float inStepTime, int inMaxSubstepCount);
+
+        /**
+         * Adds frame time & returns number of steps to simulate this frame.
+         * Time beyond max substeps (stall, breakpoint, loading hitch) is dropped instead of carried,
+         * otherwise a slow frame schedules more steps which makes next frame slower still.
+         * @param inFrameTime seconds since last advance
+         */
+        int Advance(float inFrameTime);
+
+        /**
+         * Leftover time as fraction of a step, 0 - 1
+         * @param inPendingTime time passed since last advance that isn't accumulated yet
+         */
+        float GetAlpha(float inPendingTime = 0.0f) const;
+
+        float GetStepTime() const {
+            return StepTime;
+        }
+
+        uint64_t GetDroppedStepCount() const {
+            return DroppedStepCount;
+        }
+
+    private:
+        const float StepTime;
+        const int MaxSubstepCount;
+        double Accumulator;
+        uint64_t DroppedStepCount;
+    };
+}
+
+#endif //MEOWENGINE_FIXED_TIMESTEP_HPP
@@ -8,15 +8,46 @@
 #include <transform3d_component.hpp>
 #include <rigidbody_component.hpp>
 #include <collider_component.hpp>
+#include "entt_wrapper.hpp"
+#include "vector"
 
 using namespace MeowEngine::entity;
 
 namespace MeowEngine::simulator {
+    /**
+     * Components of one staging entity that gets a physics body
+     */
+    struct RigidbodyBinding {
+        entity::Transform3DComponent* Transform;
+        entity::ColliderComponent* Collider;
+        entity::RigidbodyComponent* Rigidbody;
+
+        // kept on the body, so active bodies map back to their entity
+        entt::entity Entity;
+    };
+
     struct Physics {
         virtual void Create() = 0;
         virtual void Update(float inFixedDeltaTime) = 0;
 
-        virtual void AddRigidbody(entity::Transform3DComponent& transform, entity::ColliderComponent& collider, entity::RigidbodyComponent& rigidbody) = 0;
+        virtual void AddRigidbody(entt::entity inEntity, entity::Transform3DComponent& transform, entity::ColliderComponent& collider, entity::RigidbodyComponent& rigidbody) = 0;
+
+        /**
+         * Creates bodies for a whole spawn batch & inserts them into the scene in one go
+         */
+        virtual void AddRigidbodies(const std::vector<RigidbodyBinding>& inBindings) = 0;
+
+        /**
+         * Takes bodies out of the scene & releases them, rigidbodies are left without a body
+         */
+        virtual void RemoveRigidbodies(const std::vector<entity::RigidbodyComponent*>& inRigidbodies) = 0;
+
+        /**
+         * Entities of bodies that were awake in any step since the last ClearActiveEntities, repeats across steps.
+         * Sleeping bodies never show up.
+         */
+        virtual const std::vector<entt::entity>& GetActiveEntities() const = 0;
+        virtual void ClearActiveEntities() = 0;
     };
 }
 
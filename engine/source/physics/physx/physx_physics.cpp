@@ -5,6 +5,16 @@
 #include <log.hpp>
 #include "physx_physics.hpp"
 
+namespace {
+    void* ToUserData(entt::entity inEntity) {
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(entt::to_integral(inEntity)));
+    }
+
+    entt::entity FromUserData(void* inUserData) {
+        return static_cast<entt::entity>(static_cast<entt::id_type>(reinterpret_cast<uintptr_t>(inUserData)));
+    }
+}
+
 MeowEngine::simulator::PhysXPhysics::PhysXPhysics() {
     gFoundation = PxCreateFoundation(PX_PHYSICS_VERSION, gAllocator, gErrorCallback);
     gPhysics = PxCreatePhysics(PX_PHYSICS_VERSION, *gFoundation, physx::PxTolerancesScale(), true, nullptr);
@@ -15,13 +25,18 @@ MeowEngine::simulator::PhysXPhysics::PhysXPhysics() {
     sceneDesc.cpuDispatcher = physx::PxDefaultCpuDispatcherCreate(2);
     sceneDesc.filterShader = physx::PxDefaultSimulationFilterShader;
 
+    // sync only pulls bodies that moved, resting ones cost nothing per step
+    sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
+
     gScene = gPhysics->createScene(sceneDesc);
+    gDefaultMaterial = gPhysics->createMaterial(0.5f, 0.5f, 0.6f);
 
     MeowEngine::Log("Physics", "Constructed");
 }
 
 MeowEngine::simulator::PhysXPhysics::~PhysXPhysics() {
     gScene->release();
+    gDefaultMaterial->release();
     gPhysics->release();
     gFoundation->release();
 
@@ -57,9 +72,26 @@ void MeowEngine::simulator::PhysXPhysics::Update(float inFixedDeltaTime) {
         gScene->simulate(inFixedDeltaTime);
         gScene->fetchResults(true);
   //  }
+
+    physx::PxU32 activeCount = 0;
+    physx::PxActor** activeActors = gScene->getActiveActors(activeCount);
+
+    // only dynamic bodies carry an entity, the ground plane is static & never active
+    for(physx::PxU32 i = 0; i < activeCount; i++) {
+        ActiveEntities.push_back(FromUserData(activeActors[i]->userData));
+    }
+}
+
+const std::vector<entt::entity>& MeowEngine::simulator::PhysXPhysics::GetActiveEntities() const {
+    return ActiveEntities;
 }
 
-void MeowEngine::simulator::PhysXPhysics::AddRigidbody(entity::Transform3DComponent &transform,
+void MeowEngine::simulator::PhysXPhysics::ClearActiveEntities() {
+    ActiveEntities.clear();
+}
+
+void MeowEngine::simulator::PhysXPhysics::AddRigidbody(entt::entity inEntity,
+                                                     entity::Transform3DComponent &transform,
                                                      entity::ColliderComponent &collider,
                                                      entity::RigidbodyComponent &rigidbody) {
 
@@ -67,8 +99,74 @@ void MeowEngine::simulator::PhysXPhysics::AddRigidbody(entity::Transform3DCompon
     physx::PxReal density = 1.0f;
     physx::PxGeometry& geometry = collider.GetGeometry(); // has scale data as well
 // transform has rotation and position data
-    physx::PxRigidDynamic* actor = physx::PxCreateDynamic(*gPhysics, physicsTransform, geometry, *gPhysics->createMaterial(0.5f, 0.5f, 0.6f), density);
+    physx::PxRigidDynamic* actor = physx::PxCreateDynamic(*gPhysics, physicsTransform, geometry, *gDefaultMaterial, density);
+    actor->userData = ::ToUserData(inEntity);
 
     rigidbody.SetPhysicsBody(actor);
     gScene->addActor(*actor);
-}
\ No newline at end of file
+}
+
+void MeowEngine::simulator::PhysXPhysics::AddRigidbodies(const std::vector<RigidbodyBinding>& inBindings) {
+    if(inBindings.empty()) {
+        return;
+    }
+
+    std::vector<physx::PxActor*> actors;
+    actors.reserve(inBindings.size());
+
+    physx::PxReal density = 1.0f;
+
+    // batch entities are copies of one archetype, so consecutive bodies usually point at the same collider geometry.
+    // they share one non exclusive shape instead of building a shape each
+    const physx::PxGeometry* sharedGeometry = nullptr;
+    physx::PxShape* sharedShape = nullptr;
+
+    for(const RigidbodyBinding& binding : inBindings) {
+        const physx::PxGeometry& geometry = binding.Collider->GetGeometry();
+
+        if(&geometry != sharedGeometry) {
+            if(sharedShape) {
+                sharedShape->release();
+            }
+
+            sharedGeometry = &geometry;
+            sharedShape = gPhysics->createShape(geometry, *gDefaultMaterial, false);
+        }
+
+        const MeowEngine::math::Vector3& position = binding.Transform->Position;
+        physx::PxRigidDynamic* actor = physx::PxCreateDynamic(*gPhysics, physx::PxTransform(physx::PxVec3(position.X, position.Y, position.Z)), *sharedShape, density);
+        actor->userData = ::ToUserData(binding.Entity);
+
+        binding.Rigidbody->SetPhysicsBody(actor);
+        actors.push_back(actor);
+    }
+
+    // actors keep their own reference to the shape
+    sharedShape->release();
+
+    gScene->addActors(actors.data(), static_cast<physx::PxU32>(actors.size()));
+}
+
+void MeowEngine::simulator::PhysXPhysics::RemoveRigidbodies(const std::vector<entity::RigidbodyComponent*>& inRigidbodies) {
+    std::vector<physx::PxActor*> actors;
+    actors.reserve(inRigidbodies.size());
+
+    for(entity::RigidbodyComponent* rigidbody : inRigidbodies) {
+        if(rigidbody->GetPhysicsBody() != nullptr) {
+            actors.push_back(rigidbody->GetPhysicsBody());
+            rigidbody->SetPhysicsBody(nullptr);
+        }
+    }
+
+    if(actors.empty()) {
+        return;
+    }
+
+    // called between steps, so the scene isn't simulating while actors leave it
+    gScene->removeActors(actors.data(), static_cast<physx::PxU32>(actors.size()));
+
+    // shapes are released along with their last actor
+    for(physx::PxActor* actor : actors) {
+        actor->release();
+    }
+}
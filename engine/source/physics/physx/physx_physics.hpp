@@ -19,7 +19,12 @@ namespace MeowEngine::simulator {
         void Create() override;
         void Update(float inFixedDeltaTime) override;
 
-        void AddRigidbody(entity::Transform3DComponent& transform, entity::ColliderComponent& collider, entity::RigidbodyComponent& rigidbody) override;
+        void AddRigidbody(entt::entity inEntity, entity::Transform3DComponent& transform, entity::ColliderComponent& collider, entity::RigidbodyComponent& rigidbody) override;
+        void AddRigidbodies(const std::vector<RigidbodyBinding>& inBindings) override;
+        void RemoveRigidbodies(const std::vector<entity::RigidbodyComponent*>& inRigidbodies) override;
+
+        const std::vector<entt::entity>& GetActiveEntities() const override;
+        void ClearActiveEntities() override;
 
     private:
         // PhysX Foundation
@@ -28,8 +33,14 @@ namespace MeowEngine::simulator {
         physx::PxFoundation* gFoundation = nullptr;
         physx::PxPhysics* gPhysics = nullptr;
 
+        // shared by every dynamic body, creating one per body was never released
+        physx::PxMaterial* gDefaultMaterial = nullptr;
+
         // PhysX Scene Items
         physx::PxScene* gScene;
+
+        // collected after every step, PhysX only keeps the active actors of the last one
+        std::vector<entt::entity> ActiveEntities;
 //        physx::PxTransform testTransform;
 //        physx::PxRigidDynamic* body;
     };
@@ -22,9 +22,15 @@
 
 #include "rigidbody_component.hpp"
 #include "entt_buffer.hpp"
+#include "component_sync_traits.hpp"
 #include "entt_reflection_wrapper.hpp"
+#include "scene_serializer.hpp"
 
 #include "physx_physics.hpp"
+#include "render_snapshot.hpp"
+#include "double_buffer.hpp"
+#include "algorithm"
+#include "iterator"
 
 using MeowEngine::MainScene;
 
@@ -47,15 +53,72 @@ struct MainScene::Internal {
 
     EnttBuffer RegistryBuffer;
 
+    // shared by every spawned & loaded cube, owned here so scenes don't leak one set each
+    MeowEngine::StaticMeshInstance CubeMeshInstance;
+    entity::BoxColliderData CubeColliderData;
+
+    // loaded components start from these prototypes, meshes & colliders share one instance like spawned cubes do
+    MeowEngine::SceneSerializer SceneFile;
+
+    // current is written by main at sync, final is drawn by render, swapped together with registries
+    MeowEngine::DoubleBuffer<MeowEngine::RenderSnapshot> RenderSnapshots;
+
+    // cubes spawned from input, cleared together with backspace
+    std::vector<entt::entity> SpawnedCubes;
+
+    // physics thread only. Bodies PhysX reported awake last frame, sorted. They are synced once more after falling
+    // asleep so their previous & latest poses settle, everything else resting is never touched.
+    std::vector<entt::entity> AwakeRigidbodies;
+    std::vector<entt::entity> PreviousAwakeRigidbodies;
+    std::vector<entt::entity> SyncedRigidbodies;
+
+    std::shared_ptr<MeowEngine::JobSystem> Jobs;
+
+    float PhysicsAlpha;
+
     // User Input Events
     const uint8_t* KeyboardState; // SDL owns the object & will manage the lifecycle. We just keep a pointer.
 
-    Internal(const MeowEngine::WindowSize& size)
+    Internal(const MeowEngine::WindowSize& size, std::shared_ptr<MeowEngine::JobSystem> inJobSystem)
         : Camera(::CreateCamera(size))
         , CameraController({glm::vec3(0.0f, 2.0f , -10.0f)})
         , KeyboardState(SDL_GetKeyboardState(nullptr))
         , RegistryBuffer()
-    {}
+        , CubeMeshInstance(assets::StaticMeshType::Cube, assets::TextureType::Pattern)
+        , CubeColliderData()
+        , Jobs(std::move(inJobSystem))
+        , PhysicsAlpha(1.0f)
+    {
+        RegistryBuffer.TrackChanges<entity::Transform3DComponent>();
+
+        // both registries, current & final trade places every swap
+        RegistryBuffer.GetCurrent().on_construct<entity::Transform3DComponent>().connect<&entity::Transform3DComponent::SeedRandomOnConstruct>();
+        RegistryBuffer.GetFinal().on_construct<entity::Transform3DComponent>().connect<&entity::Transform3DComponent::SeedRandomOnConstruct>();
+
+        // main loads scenes through reflection before render starts, so components are registered up front
+        RegisterComponents();
+    }
+
+    void RegisterComponents() {
+        REGISTER_ENTT_COMPONENT(LifeObjectComponent);
+
+        REGISTER_ENTT_COMPONENT(Transform2DComponent);
+        REGISTER_ENTT_COMPONENT(Transform3DComponent);
+
+        REGISTER_ENTT_COMPONENT(ColliderComponent);
+        REGISTER_ENTT_COMPONENT(RigidbodyComponent);
+
+        REGISTER_ENTT_COMPONENT(RenderComponentBase);
+        REGISTER_ENTT_COMPONENT(LineRenderComponent);
+        REGISTER_ENTT_COMPONENT(MeshRenderComponent);
+
+        SceneFile.RegisterComponent(entity::LifeObjectComponent(""));
+        SceneFile.RegisterComponent(entity::Transform3DComponent(glm::mat4(1.0f)));
+        SceneFile.RegisterComponent(entity::ColliderComponent(entity::ColliderType::BOX, &CubeColliderData));
+        SceneFile.RegisterComponent(entity::RigidbodyComponent());
+        SceneFile.RegisterComponent(entity::RenderComponentBase());
+        SceneFile.RegisterComponent(entity::MeshRenderComponent(assets::ShaderPipelineType::Default, &CubeMeshInstance));
+    }
 
     void OnWindowResized(const MeowEngine::WindowSize& size) {
         Camera = ::CreateCamera(size);
@@ -81,18 +144,6 @@ struct MainScene::Internal {
                                            assets::TextureType::Default,
                                            assets::TextureType::Pattern
                                    });
-
-        REGISTER_ENTT_COMPONENT(LifeObjectComponent);
-
-        REGISTER_ENTT_COMPONENT(Transform2DComponent);
-        REGISTER_ENTT_COMPONENT(Transform3DComponent);
-
-        REGISTER_ENTT_COMPONENT(ColliderComponent);
-        REGISTER_ENTT_COMPONENT(RigidbodyComponent);
-
-        REGISTER_ENTT_COMPONENT(RenderComponentBase);
-        REGISTER_ENTT_COMPONENT(LineRenderComponent);
-        REGISTER_ENTT_COMPONENT(MeshRenderComponent);
     }
 
     void AddEntitiesOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) {
@@ -194,6 +245,14 @@ struct MainScene::Internal {
         MeowEngine::Log("Creating", "Created");
     }
 
+    bool LoadSceneOnMainThread(const std::string& inPath) {
+        return SceneFile.Load(inPath, RegistryBuffer);
+    }
+
+    bool SaveSceneOnMainThread(const std::string& inPath) {
+        return SceneFile.Save(inPath, RegistryBuffer.GetCurrent());
+    }
+
     void Input(const float& delta, const MeowEngine::input::InputManager& inputManager) {
         if(!inputManager.isActive) {
             return;
@@ -204,32 +263,17 @@ struct MainScene::Internal {
         }
 
         if(inputManager.isMouseDown && (inputManager.mouseState & SDL_BUTTON_RMASK)) {
-            const auto cubeEntity = RegistryBuffer.AddEntity();
-            RegistryBuffer.AddComponent<entity::LifeObjectComponent>(cubeEntity, "cube");
-            RegistryBuffer.AddComponent<entity::Transform3DComponent>(
-                    cubeEntity,
-                    Camera.GetProjectionMatrix() * Camera.GetViewMatrix(),
-                    glm::vec3{0.0f, 20.0f, 2},
-                    glm::vec3{0.5f, 0.5f,0.5f},
-                    glm::vec3{0.0f, 1.0f, 0.0f},
-                    0
-            );
-            RegistryBuffer.AddComponent<entity::MeshRenderComponent>(
-                    cubeEntity,
-                    assets::ShaderPipelineType::Default,
-                    new MeowEngine::StaticMeshInstance{
-                            assets::StaticMeshType::Cube,
-                            assets::TextureType::Pattern
-                    }
-            );
-            RegistryBuffer.AddComponent<entity::ColliderComponent>(
-                    cubeEntity,
-                    entity::ColliderType::BOX,
-                    new entity::BoxColliderData()
-            );
-            RegistryBuffer.AddComponent<entity::RigidbodyComponent>(
-                    cubeEntity
-            );
+            if(KeyboardState[SDL_SCANCODE_LSHIFT]) {
+                SpawnCubeGrid(10, 10, 10);
+            }
+            else {
+                SpawnCubes(1);
+            }
+        }
+
+        if(KeyboardState[SDL_SCANCODE_BACKSPACE] && !SpawnedCubes.empty()) {
+            RegistryBuffer.RemoveEntities(SpawnedCubes);
+            SpawnedCubes.clear();
         }
 
         if (KeyboardState[SDL_SCANCODE_UP] || KeyboardState[SDL_SCANCODE_W]) {
@@ -257,6 +301,59 @@ struct MainScene::Internal {
 //        }
     }
 
+    /**
+     * Cube spawns go through the batch api, all cubes share one mesh instance & collider data
+     */
+    void SpawnCubes(std::size_t inCount) {
+        std::vector<entt::entity> cubes = RegistryBuffer.AddEntities(
+                inCount,
+                entity::LifeObjectComponent("cube"),
+                CreateCubeTransform(glm::vec3{0.0f, 20.0f, 2}),
+                entity::MeshRenderComponent(assets::ShaderPipelineType::Default, &CubeMeshInstance),
+                entity::ColliderComponent(entity::ColliderType::BOX, &CubeColliderData),
+                entity::RigidbodyComponent()
+        );
+
+        SpawnedCubes.insert(SpawnedCubes.end(), cubes.begin(), cubes.end());
+    }
+
+    void SpawnCubeGrid(int inWidth, int inHeight, int inDepth) {
+        std::vector<entity::Transform3DComponent> transforms;
+        transforms.reserve(inWidth * inHeight * inDepth);
+
+        for(int y = 0; y < inHeight; y++) {
+            for(int x = 0; x < inWidth; x++) {
+                for(int z = 0; z < inDepth; z++) {
+                    transforms.push_back(CreateCubeTransform(glm::vec3{
+                        static_cast<float>(x - inWidth / 2),
+                        20.0f + static_cast<float>(y),
+                        static_cast<float>(z - inDepth / 2)
+                    }));
+                }
+            }
+        }
+
+        std::vector<entt::entity> cubes = RegistryBuffer.AddEntities<entity::Transform3DComponent>(
+                transforms,
+                entity::LifeObjectComponent("cube"),
+                entity::MeshRenderComponent(assets::ShaderPipelineType::Default, &CubeMeshInstance),
+                entity::ColliderComponent(entity::ColliderType::BOX, &CubeColliderData),
+                entity::RigidbodyComponent()
+        );
+
+        SpawnedCubes.insert(SpawnedCubes.end(), cubes.begin(), cubes.end());
+    }
+
+    entity::Transform3DComponent CreateCubeTransform(const glm::vec3& inPosition) {
+        return entity::Transform3DComponent(
+                Camera.GetProjectionMatrix() * Camera.GetViewMatrix(),
+                inPosition,
+                glm::vec3{0.5f, 0.5f,0.5f},
+                glm::vec3{0.0f, 1.0f, 0.0f},
+                0
+        );
+    }
+
     // We can perform -> culling, input detection
     void Update(const float& deltaTime) {
         Camera.Configure(CameraController.GetPosition(), CameraController.GetUp(), CameraController.GetDirection());
@@ -270,11 +367,20 @@ struct MainScene::Internal {
 //        MeowEngine::Log("Camera", std::to_string(Camera.GetPosition().z));
 
         auto view = RegistryBuffer.GetCurrent().view<entity::Transform3DComponent>();
-        for(auto entity: view) {
-            auto& transform = view.get<entity::Transform3DComponent>(entity);
+
+        // transforms don't depend on each other, so we split them across workers
+        MeowEngine::JobCounter updateCounter;
+        const float physicsAlpha = PhysicsAlpha;
+        MeowEngine::DirtyBitset& transformChanges = RegistryBuffer.GetCurrentChanges<entity::Transform3DComponent>();
+        Jobs->ParallelForEach(view, 256, [&view, &deltaTime, &cameraMatrix, physicsAlpha, &transformChanges](entt::entity inEntity) {
+            auto& transform = view.get<entity::Transform3DComponent>(inEntity);
             transform.Update(deltaTime);
-            transform.CalculateTransformMatrix(cameraMatrix);
-        }
+            transform.CalculateTransformMatrix(cameraMatrix, physicsAlpha);
+
+            // matrix is per frame anyway (camera), only position is synced to other buffers
+            transformChanges.MarkConcurrent(entt::to_entity(inEntity));
+        }, &updateCounter);
+        Jobs->Wait(updateCounter);
 
         //        auto view = registry.view<MeowEngine::core::component::Transform3DComponent>();
 //        for(auto entity: view)
@@ -315,10 +421,43 @@ struct MainScene::Internal {
         // This is important for now - we can come to this later for optimization
         // Current goal is to have full control on render as individual objects
         // as we will have elements like UI, Static Meshes, Post Processing, Camera Culling, Editor Tools
-//        for(auto& lifeObject : LifeObjects) {
-//            renderer.Render(&Camera, &lifeObject);
-//        }
-        renderer.RenderGameView(&Camera, RegistryBuffer.GetFinal());
+        renderer.RenderGameView(RenderSnapshots.GetFinal());
+    }
+
+    /**
+     * Packs what render needs from current(main) registry. Instances hold model matrices, camera is applied at draw.
+     */
+    void ExtractRenderSnapshotOnMainThread() {
+        PT_PROFILE_SCOPE;
+        MeowEngine::RenderSnapshot& snapshot = RenderSnapshots.GetCurrent();
+        snapshot.Clear();
+
+        snapshot.ViewMatrix = Camera.GetViewMatrix();
+        snapshot.ProjectionMatrix = Camera.GetProjectionMatrix();
+
+        entt::registry& registry = RegistryBuffer.GetCurrent();
+
+        auto meshView = registry.view<entity::MeshRenderComponent, entity::Transform3DComponent>();
+        snapshot.MeshInstances.reserve(meshView.size_hint());
+        for(auto &&[entity, renderComponent, transform]: meshView.each())
+        {
+            snapshot.MeshInstances.push_back({
+                transform.CalculateModelMatrix(PhysicsAlpha),
+                renderComponent.GetShaderPipelineType(),
+                renderComponent.GetMesh(),
+                renderComponent.GetTexture()
+            });
+        }
+
+        for(auto &&[entity, renderComponent, transform]: registry.view<entity::RenderComponentBase, entity::Transform3DComponent>().each())
+        {
+            snapshot.GridInstances.push_back({
+                transform.CalculateModelMatrix(PhysicsAlpha),
+                renderComponent.GetShaderPipelineType(),
+                MeowEngine::assets::StaticMeshType::Plane,
+                MeowEngine::assets::TextureType::Default
+            });
+        }
     }
 
     void RenderUserInterface(MeowEngine::Renderer& renderer, unsigned int frameBufferId, const double fps) {
@@ -327,79 +466,77 @@ struct MainScene::Internal {
 
     void SwapMainAndRenderBufferOnMainThread() {
         RegistryBuffer.Swap();
+        RenderSnapshots.Swap();
     }
 
-    void SyncPhysicsBufferOnMainThread(bool inIsPhysicsThreadWorking) {
-        auto currentView = RegistryBuffer.GetCurrent().view<MeowEngine::entity::Transform3DComponent, MeowEngine::entity::RigidbodyComponent>();
-        auto stagingView = RegistryBuffer.GetStaging().view<MeowEngine::entity::Transform3DComponent, MeowEngine::entity::RigidbodyComponent>();
-        auto finalView = RegistryBuffer.GetFinal().view<MeowEngine::entity::Transform3DComponent, MeowEngine::entity::RigidbodyComponent>();
-
-        if(inIsPhysicsThreadWorking) {
-            // since physics is working on its buffer (staging) we cache the main thread updates
-            for(entt::entity entity : stagingView) {
-
-                auto& staging = stagingView.get<MeowEngine::entity::RigidbodyComponent>(entity);
-                auto final = finalView.get<MeowEngine::entity::Transform3DComponent>(entity);
-                auto current = currentView.get<MeowEngine::entity::Transform3DComponent>(entity);
-
-                staging.CacheDelta(current.Position - final.Position);
-            }
-        }
-        else {
-            // since physics is not working, we can update rigidbody in physics thread
-            for (entt::entity entity: stagingView) {
-                auto staging = stagingView.get<MeowEngine::entity::Transform3DComponent>(entity);
-                auto &rigidbody = stagingView.get<MeowEngine::entity::RigidbodyComponent>(entity);
-                auto &final = finalView.get<MeowEngine::entity::Transform3DComponent>(entity);
-
-                auto &current = currentView.get<MeowEngine::entity::Transform3DComponent>(entity);
-
-                rigidbody.AddDelta(current.Position - final.Position);
-                current.Position = staging.Position;
-            }
-        }
+    void SyncPhysicsBufferOnMainThread() {
+        RegistryBuffer.SyncPhysicsOnMain<MeowEngine::entity::Transform3DComponent>();
     }
 
     void SyncRenderBufferOnMainThread() {
-        // Add a template method to apply changes
-        // Each component will have a apply data method
-        // We will have data and component methods
-        // Data will always my permanant with no apply data method
-        // Components will always have apply method
-        // Sync Transform Component
-        auto currentView = RegistryBuffer.GetCurrent().view<MeowEngine::entity::Transform3DComponent>();
-        auto finalView = RegistryBuffer.GetFinal().view<MeowEngine::entity::Transform3DComponent>();
-
-        for(entt::entity entity : currentView) {
-            auto current = currentView.get<MeowEngine::entity::Transform3DComponent>(entity);
-            auto& final = finalView.get<MeowEngine::entity::Transform3DComponent>(entity);
-
-            final.Position = current.Position;
-        }
+        ExtractRenderSnapshotOnMainThread();
+        RegistryBuffer.SyncRenderOnMain<MeowEngine::entity::Transform3DComponent>();
+    }
 
-        // Apply UI inputs to render and main buffers
-        // Push UI inputs for physics buffer (which gets processed in physics thread)
-        RegistryBuffer.ApplyPropertyChange();
+    void SyncPhysicsBufferOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) {
+        RegistryBuffer.SyncPhysicsOnStaging<MeowEngine::entity::Transform3DComponent>([&] {
+            SyncRigidbodiesOnPhysicsThread(inPhysics);
+        });
     }
 
-    void SyncPhysicsBufferOnPhysicsThread() {
-        // Apply update physics transform to entities
+    /**
+     * Copies poses of bodies PhysX moved onto staging, runs between main's deltas & publishing results
+     */
+    void SyncRigidbodiesOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) {
+        const std::vector<entt::entity>& activeEntities = inPhysics->GetActiveEntities();
+        PreviousAwakeRigidbodies.swap(AwakeRigidbodies);
+        AwakeRigidbodies.assign(activeEntities.begin(), activeEntities.end());
+        inPhysics->ClearActiveEntities();
+
+        // an entity is reported once per step it was awake in
+        std::sort(AwakeRigidbodies.begin(), AwakeRigidbodies.end());
+        AwakeRigidbodies.erase(std::unique(AwakeRigidbodies.begin(), AwakeRigidbodies.end()), AwakeRigidbodies.end());
+
+        SyncedRigidbodies.clear();
+        std::set_union(AwakeRigidbodies.begin(), AwakeRigidbodies.end(),
+                       PreviousAwakeRigidbodies.begin(), PreviousAwakeRigidbodies.end(),
+                       std::back_inserter(SyncedRigidbodies));
+
+        // Apply update physics transform to entities, ids of removed entities fail the version check
         auto view = RegistryBuffer.GetStaging().view<entity::Transform3DComponent, entity::RigidbodyComponent>();
-        for(auto entity: view)
+        MeowEngine::DirtyBitset& stagingChanges = RegistryBuffer.GetStagingChanges<entity::Transform3DComponent>();
+        for(entt::entity entity : SyncedRigidbodies)
         {
+            if(!view.contains(entity)) {
+                continue;
+            }
+
             auto& transform = view.get<entity::Transform3DComponent>(entity);
             auto& rigidbody = view.get<entity::RigidbodyComponent>(entity);
 
-            rigidbody.UpdateTransform(transform);
+            if(rigidbody.UpdateTransform(transform)) {
+                stagingChanges.Mark(entt::to_entity(entity));
+            }
         }
+    }
+
+    void CapturePreviousPhysicsPosesOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) {
+        auto& rigidbodyStorage = RegistryBuffer.GetStaging().storage<entity::RigidbodyComponent>();
+        auto capture = [&rigidbodyStorage](entt::entity inEntity) {
+            if(rigidbodyStorage.contains(inEntity)) {
+                rigidbodyStorage.get(inEntity).CapturePreviousPose();
+            }
+        };
 
-        // Apply UI inputs to physics components
-        RegistryBuffer.ApplyPropertyChangeOnStaging();
+        // bodies awake last frame or in earlier steps of this one, a body that wakes in the last step was resting
+        // & falls back to its last published pose
+        std::for_each(AwakeRigidbodies.begin(), AwakeRigidbodies.end(), capture);
+        std::for_each(inPhysics->GetActiveEntities().begin(), inPhysics->GetActiveEntities().end(), capture);
     }
 };
 
-MainScene::MainScene(const MeowEngine::WindowSize& size)
-    : InternalPointer(MeowEngine::make_internal_ptr<Internal>(size)){}
+MainScene::MainScene(const MeowEngine::WindowSize& size, std::shared_ptr<MeowEngine::JobSystem> inJobSystem)
+    : InternalPointer(MeowEngine::make_internal_ptr<Internal>(size, inJobSystem)){}
 
 void MainScene::OnWindowResized(const MeowEngine::WindowSize &size) {
     InternalPointer->OnWindowResized(size);
@@ -412,6 +549,14 @@ void MainScene::CreateSceneOnMainThread() {
     InternalPointer->CreateSceneOnMainThread();
 }
 
+bool MainScene::LoadSceneOnMainThread(const std::string& inPath) {
+    return InternalPointer->LoadSceneOnMainThread(inPath);
+}
+
+bool MainScene::SaveSceneOnMainThread(const std::string& inPath) {
+    return InternalPointer->SaveSceneOnMainThread(inPath);
+}
+
 void MainScene::AddEntitiesOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) {
     InternalPointer->AddEntitiesOnPhysicsThread(inPhysics);
 }
@@ -420,10 +565,22 @@ void MainScene::Input(const float &deltaTime, const MeowEngine::input::InputMana
     InternalPointer->Input(deltaTime, inputManager);
 }
 
+void MainScene::SpawnCubeGridOnMainThread(int inWidth, int inHeight, int inDepth) {
+    InternalPointer->SpawnCubeGrid(inWidth, inHeight, inDepth);
+}
+
+void MainScene::SetJobSystem(std::shared_ptr<MeowEngine::JobSystem> inJobSystem) {
+    InternalPointer->Jobs = std::move(inJobSystem);
+}
+
 void MainScene::Update(const float &deltaTime) {
     InternalPointer->Update(deltaTime);
 }
 
+void MainScene::SetPhysicsInterpolation(const float &inAlpha) {
+    InternalPointer->PhysicsAlpha = inAlpha;
+}
+
 void MainScene::RenderGameView(MeowEngine::Renderer &renderer) {
     InternalPointer->RenderGameView(renderer);
 }
@@ -436,16 +593,20 @@ void MainScene::SwapMainAndRenderBufferOnMainThread() {
     InternalPointer->SwapMainAndRenderBufferOnMainThread();
 }
 
-void MainScene::SyncPhysicsBufferOnMainThread(bool inIsPhysicsThreadWorking) {
-    InternalPointer->SyncPhysicsBufferOnMainThread(inIsPhysicsThreadWorking);
+void MainScene::SyncPhysicsBufferOnMainThread() {
+    InternalPointer->SyncPhysicsBufferOnMainThread();
 }
 
 void MainScene::SyncRenderBufferOnMainThread() {
     InternalPointer->SyncRenderBufferOnMainThread();
 }
 
-void MainScene::SyncPhysicsBufferOnPhysicsThread() {
-    InternalPointer->SyncPhysicsBufferOnPhysicsThread();
+void MainScene::SyncPhysicsBufferOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) {
+    InternalPointer->SyncPhysicsBufferOnPhysicsThread(inPhysics);
+}
+
+void MainScene::CapturePreviousPhysicsPosesOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) {
+    InternalPointer->CapturePreviousPhysicsPosesOnPhysicsThread(inPhysics);
 }
 
 
@@ -8,26 +8,41 @@
 #include "internal_ptr.hpp"
 #include "scene.hpp"
 #include "window_size.hpp"
+#include "job_system.hpp"
 
 namespace MeowEngine {
     struct MainScene : public MeowEngine::Scene {
-        MainScene(const MeowEngine::WindowSize& frameSize);
+        MainScene(const MeowEngine::WindowSize& frameSize, std::shared_ptr<MeowEngine::JobSystem> inJobSystem);
 
         void OnWindowResized(const MeowEngine::WindowSize& size) override;
 
         virtual void LoadOnRenderThread(std::shared_ptr<MeowEngine::AssetManager> assetManager) override;
         void CreateSceneOnMainThread() override;
+        bool LoadSceneOnMainThread(const std::string& inPath) override;
+        bool SaveSceneOnMainThread(const std::string& inPath) override;
         void AddEntitiesOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) override;
         void Input(const float &deltaTime, const MeowEngine::input::InputManager& inputManager) override;
 
+        /**
+         * Same batch spawn as shift + right click, for callers without input (benchmarks)
+         */
+        void SpawnCubeGridOnMainThread(int inWidth, int inHeight, int inDepth);
+
+        /**
+         * Moves main thread jobs to another scheduler, only between frames (benchmarks compare worker counts on one scene)
+         */
+        void SetJobSystem(std::shared_ptr<MeowEngine::JobSystem> inJobSystem);
+
         void Update(const float& deltaTime) override;
+        void SetPhysicsInterpolation(const float& inAlpha) override;
         void RenderGameView(MeowEngine::Renderer& renderer) override;
         void RenderUserInterface(MeowEngine::Renderer& renderer, unsigned int frameBufferId, const double fps) override;
         void SwapMainAndRenderBufferOnMainThread() override;
 //        void CalculateDeltaData() override;
-        void SyncPhysicsBufferOnMainThread(bool inIsPhysicsThreadWorking) override;
+        void SyncPhysicsBufferOnMainThread() override;
         void SyncRenderBufferOnMainThread() override;
-        void SyncPhysicsBufferOnPhysicsThread() override;
+        void SyncPhysicsBufferOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) override;
+        void CapturePreviousPhysicsPosesOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) override;
 
     private:
         struct Internal;
@@ -9,6 +9,7 @@
 #include "input_manager.hpp"
 #include "renderer.hpp"
 #include "physics.hpp"
+#include "string"
 
 namespace MeowEngine {
     struct Scene {
@@ -27,6 +28,17 @@ namespace MeowEngine {
          */
         virtual void CreateSceneOnMainThread() = 0;
 
+        /**
+         * Loads a scene saved with SaveSceneOnMainThread instead of creating one
+         * @return false when the file can't be read, nothing is added then
+         */
+        virtual bool LoadSceneOnMainThread(const std::string& inPath) = 0;
+
+        /**
+         * Writes every entity with its reflected components, main thread's registry is read
+         */
+        virtual bool SaveSceneOnMainThread(const std::string& inPath) = 0;
+
         /**
          * When a entity is created on main thread, out buffer queues the entity to be created on physics thread
          * and adds to staging(physics) buffer
@@ -42,6 +54,12 @@ namespace MeowEngine {
 
         virtual void Update(const float& deltaTime) = 0;
 
+        /**
+         * Where render sits between previous & latest physics pose, used by next Update when building transforms
+         * @param inAlpha 0 - 1
+         */
+        virtual void SetPhysicsInterpolation(const float& inAlpha) = 0;
+
         // -----------------------------
 
         virtual void RenderGameView(MeowEngine::Renderer& renderer) = 0;
@@ -57,12 +75,10 @@ namespace MeowEngine {
         // -----------------------------
 
         /**
-         * Based on availability of staging(physics) buffer  we either
-         * cache or sync data from main & render to physics & vice versa
-         * i.e. we take the updates from physics thread and push the updates from main thread w.r.t render thread
-         * @param inIsPhysicsThreadWorking
+         * Takes the newest results physics published & mails main thread updates w.r.t render thread to physics.
+         * Runs every frame without waiting on physics.
          */
-        virtual void SyncPhysicsBufferOnMainThread(bool inIsPhysicsThreadWorking) = 0;
+        virtual void SyncPhysicsBufferOnMainThread() = 0;
 
         /**
          * Sync UI updates and push main thread updates on final(render) buffer
@@ -71,9 +87,17 @@ namespace MeowEngine {
         virtual void SyncRenderBufferOnMainThread() = 0;
 
         /**
-         * Push rigidbody updates to transform & apply UI inputs to staging(physics) buffer
+         * Apply main thread deltas & UI inputs, push updates of bodies physics reported active to transform
+         * & publish them for main thread
+         * @param inPhysics
+         */
+        virtual void SyncPhysicsBufferOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) = 0;
+
+        /**
+         * Cache poses of awake rigidbodies before the last physics step of a frame, so they can be published as previous pose
+         * @param inPhysics
          */
-        virtual void SyncPhysicsBufferOnPhysicsThread() = 0;
+        virtual void CapturePreviousPhysicsPosesOnPhysicsThread(MeowEngine::simulator::Physics* inPhysics) = 0;
 
         // -----------------------------
     };